@@ -0,0 +1,71 @@
+#include <chrono>
+#include <iostream>
+
+#include "../core.hpp"
+
+#define RUNS 2000
+
+/// operand of `len` limbs filled by a linear congruential generator.
+apa::bint operand(size_t len, uint64_t seed) {
+    apa::limb_t *limbs = (apa::limb_t *) std::malloc(len * sizeof(apa::limb_t));
+    for (size_t i = 0; i < len; ++i) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        limbs[i] = (apa::limb_t) (seed >> 17);
+    }
+    limbs[len - 1] |= 1;
+    return apa::bint(limbs, len, len, apa::POSITIVE);
+}
+
+int main() {
+    const size_t sizes[6] = {2, 4, 8, 16, 32, 64};
+    bool correct = true;
+
+    std::cout << "### Using base 2<sup>" << sizeof(apa::limb_t) * 8
+              << "</sup> number system representation.\n\n"
+                 "| modulus limbs | (a * b) % m | mulmod(a, b) | (a * a) % m | sqrmod(a) |\n"
+                 "| ------------- | ----------- | ------------ | ----------- | --------- |\n";
+
+    for (size_t s = 0; s < 6; ++s) {
+        size_t n = sizes[s];
+        apa::bint m = operand(n, n), a = operand(n, n * 3 + 1) % m, b = operand(n, n * 5 + 7) % m;
+        apa::barrett_context context(m);
+        apa::bint div_mul, barrett_mul, div_sqr, barrett_sqr;
+
+        // heat up
+        for (size_t i = 0; i < RUNS / 10; ++i) {
+            div_mul = (a * b) % m;
+            barrett_mul = context.mulmod(a, b);
+        }
+
+        size_t div_mul_total = 0, barrett_mul_total = 0, div_sqr_total = 0, barrett_sqr_total = 0;
+        for (size_t i = 0; i < RUNS; ++i) {
+            auto start1 = std::chrono::high_resolution_clock::now();
+            div_mul = (a * b) % m;
+            auto end1 = std::chrono::high_resolution_clock::now();
+            div_mul_total += std::chrono::duration_cast<std::chrono::nanoseconds>(end1 - start1).count();
+
+            auto start2 = std::chrono::high_resolution_clock::now();
+            barrett_mul = context.mulmod(a, b);
+            auto end2 = std::chrono::high_resolution_clock::now();
+            barrett_mul_total += std::chrono::duration_cast<std::chrono::nanoseconds>(end2 - start2).count();
+
+            auto start3 = std::chrono::high_resolution_clock::now();
+            div_sqr = a.square() % m;
+            auto end3 = std::chrono::high_resolution_clock::now();
+            div_sqr_total += std::chrono::duration_cast<std::chrono::nanoseconds>(end3 - start3).count();
+
+            auto start4 = std::chrono::high_resolution_clock::now();
+            barrett_sqr = context.sqrmod(a);
+            auto end4 = std::chrono::high_resolution_clock::now();
+            barrett_sqr_total += std::chrono::duration_cast<std::chrono::nanoseconds>(end4 - start4).count();
+        }
+
+        correct &= div_mul == barrett_mul && div_sqr == barrett_sqr;
+
+        std::cout << "| " << n << " | " << div_mul_total / RUNS << " ns | " << barrett_mul_total / RUNS << " ns | "
+                  << div_sqr_total / RUNS << " ns | " << barrett_sqr_total / RUNS << " ns |\n";
+    }
+    std::cout << "\n";
+
+    return !correct;
+}
@@ -314,6 +314,73 @@ int main() {
         case3_total += duration3.count();
     }
 
+    // unbalanced cases, the shorter operands are the top 1/4, 1/16 and 1/64 of fac2.
+    const size_t ratios[3] = {4, 16, 64};
+    apa::bint ratio_short[3], ratio_case[3];
+    size_t ratio_total[3] = {0, 0, 0};
+    bool ratio_correct = true;
+
+    for (size_t r = 0; r < 3; ++r) {
+        ratio_short[r] = fac2 >> (fac2.bit_size() - fac2.bit_size() / ratios[r]);
+        ratio_correct &= (fac2 * ratio_short[r]) == fac2.mul_naive(ratio_short[r]);
+    }
+
+    for (size_t i = 0; i < RUNS; ++i) {
+        for (size_t r = 0; r < 3; ++r) {
+            auto start = std::chrono::high_resolution_clock::now();
+            ratio_case[r] = fac2 * ratio_short[r];
+            auto end = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+            ratio_total[r] += duration.count();
+        }
+    }
+
+    // number-theoretic transform case, checked against the karatsuba kernel.
+    apa::bint ntt_op = fac1 * fac2, ntt_case;
+    while (ntt_op.limb_size() < apa::NTT_SIZE) {
+        ntt_op *= ntt_op;
+    }
+    apa::bint ntt_op2 = ntt_op + apa::__BINT_ONE;
+
+    size_t ntt_len = ntt_op.limb_size() + ntt_op2.limb_size();
+    std::vector<apa::limb_t> karatsuba_limbs(ntt_len + 1, 0);
+    apa::integer::mul_karatsuba(
+        karatsuba_limbs.data(), ntt_len, 0, ntt_op.limb_view(), ntt_op.limb_size(), 0, ntt_op2.limb_view(),
+        ntt_op2.limb_size(), 0
+    );
+
+    size_t ntt_total = 0, ntt_runs = RUNS / 10;
+    for (size_t i = 0; i < ntt_runs; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        ntt_case = ntt_op * ntt_op2;
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        ntt_total += duration.count();
+    }
+
+    bool ntt_correct = !std::memcmp(
+        ntt_case.limb_view(), karatsuba_limbs.data(), ntt_case.limb_size() * sizeof(apa::limb_t)
+    );
+
+    // parallel fan out of the largest case against the thread count, checked against one thread.
+    const size_t thread_counts[5] = {1, 2, 4, 8, 16};
+    size_t thread_total[5] = {0, 0, 0, 0, 0};
+    bool parallel_correct = true;
+
+    for (size_t t = 0; t < 5; ++t) {
+        apa::set_threads(thread_counts[t]);
+        apa::bint parallel_case;
+        for (size_t i = 0; i < ntt_runs; ++i) {
+            auto start = std::chrono::high_resolution_clock::now();
+            parallel_case = ntt_op * ntt_op2;
+            auto end = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+            thread_total[t] += duration.count();
+        }
+        parallel_correct &= parallel_case == ntt_case;
+    }
+    apa::set_threads(1);
+
     std::cout << "### Using base 2<sup>" << sizeof(apa::limb_t) * 8
               << "</sup> number system representation.\n\n"
                  "| cases | limb dimension | microseconds |\n"
@@ -326,8 +393,24 @@ int main() {
               << " μs |\n"
                  "| case 3 | "
               << fac0.limb_size() << "x" << fac2.limb_size() << " | " << case3_total / RUNS
-              << " μs |\n"
-                 "\n";
+              << " μs |\n";
+
+    for (size_t r = 0; r < 3; ++r) {
+        std::cout << "| ratio 1:" << ratios[r] << " | " << ratio_short[r].limb_size() << "x" << fac2.limb_size()
+                  << " | " << ratio_total[r] / RUNS << " μs |\n";
+    }
+    std::cout << "| ntt | " << ntt_op.limb_size() << "x" << ntt_op2.limb_size() << " | " << ntt_total / ntt_runs
+              << " μs |\n\n";
+
+    std::cout << "| threads | limb dimension | microseconds | speedup |\n"
+                 "| ------- | -------------- | ------------ | ------- |\n";
+    for (size_t t = 0; t < 5; ++t) {
+        std::cout << "| " << thread_counts[t] << " | " << ntt_op.limb_size() << "x" << ntt_op2.limb_size() << " | "
+                  << thread_total[t] / ntt_runs << " μs | " << (double) thread_total[0] / thread_total[t]
+                  << "x |\n";
+    }
+    std::cout << "\n";
 
-    return !((case1 == correct_case1) | (case2 == correct_case2));
+    return !((case1 == correct_case1) | (case2 == correct_case2)) | !ratio_correct | !ntt_correct |
+           !parallel_correct;
 }
\ No newline at end of file
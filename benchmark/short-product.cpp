@@ -0,0 +1,66 @@
+#include <chrono>
+#include <iostream>
+
+#include "../core.hpp"
+
+#define RUNS 200
+
+/// operand of `len` limbs filled by a linear congruential generator.
+apa::bint operand(size_t len, uint64_t seed) {
+    apa::limb_t *limbs = (apa::limb_t *) std::malloc(len * sizeof(apa::limb_t));
+    for (size_t i = 0; i < len; ++i) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        limbs[i] = (apa::limb_t) (seed >> 17);
+    }
+    limbs[len - 1] |= 1;
+    return apa::bint(limbs, len, len, apa::POSITIVE);
+}
+
+int main() {
+    const size_t sizes[8] = {16, 32, 64, 128, 256, 512, 1024, 2048};
+    bool correct = true;
+
+    std::cout << "### Using base 2<sup>" << sizeof(apa::limb_t) * 8
+              << "</sup> number system representation.\n\n"
+                 "| limb dimension | a * b | mul_low(a, b, n) | mul_high(a, b, n) |\n"
+                 "| -------------- | ----- | ---------------- | ----------------- |\n";
+
+    for (size_t s = 0; s < 8; ++s) {
+        size_t n = sizes[s];
+        apa::bint a = operand(n, n), b = operand(n, n * 3 + 1);
+        apa::bint full, low, high;
+
+        // heat up
+        for (size_t i = 0; i < RUNS / 10; ++i) {
+            full = a * b;
+            low = apa::mul_low(a, b, n);
+            high = apa::mul_high(a, b, n);
+        }
+
+        size_t full_total = 0, low_total = 0, high_total = 0;
+        for (size_t i = 0; i < RUNS; ++i) {
+            auto start1 = std::chrono::high_resolution_clock::now();
+            full = a * b;
+            auto end1 = std::chrono::high_resolution_clock::now();
+            full_total += std::chrono::duration_cast<std::chrono::nanoseconds>(end1 - start1).count();
+
+            auto start2 = std::chrono::high_resolution_clock::now();
+            low = apa::mul_low(a, b, n);
+            auto end2 = std::chrono::high_resolution_clock::now();
+            low_total += std::chrono::duration_cast<std::chrono::nanoseconds>(end2 - start2).count();
+
+            auto start3 = std::chrono::high_resolution_clock::now();
+            high = apa::mul_high(a, b, n);
+            auto end3 = std::chrono::high_resolution_clock::now();
+            high_total += std::chrono::duration_cast<std::chrono::nanoseconds>(end3 - start3).count();
+        }
+
+        correct &= (high << (n * apa::LIMB_BITS)) + low == full;
+
+        std::cout << "| " << n << "x" << n << " | " << full_total / RUNS << " ns | " << low_total / RUNS << " ns | "
+                  << high_total / RUNS << " ns |\n";
+    }
+    std::cout << "\n";
+
+    return !correct;
+}
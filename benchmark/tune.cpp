@@ -0,0 +1,193 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "../core.hpp"
+
+// compiled with `-D_APA_TUNING` so the thresholds of config.hpp can be moved at run time, each
+// threshold is the smallest size where the faster algorithm keeps winning over the slower one.
+
+/// never reached by any operand the tuner uses.
+#define TUNE_OFF ((size_t) -1 / 4)
+
+/// consecutive sizes the faster algorithm has to win before a crossover is accepted.
+#define TUNE_STREAK 3
+
+/// random limbs from a linear congruential generator.
+std::vector<apa::limb_t> operand(size_t len, uint64_t seed) {
+    std::vector<apa::limb_t> limbs(len);
+    for (size_t i = 0; i < len; ++i) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        limbs[i] = (apa::limb_t) (seed >> 17);
+    }
+    limbs[len - 1] |= 1;
+    return limbs;
+}
+
+/// @return the fastest of a few timing rounds in nanoseconds, a round repeats `run` for at least 1ms.
+template <typename F>
+double measure(F run) {
+    double best = 0;
+    for (size_t round = 0; round < 5; ++round) {
+        size_t runs = 0;
+        auto start = std::chrono::steady_clock::now();
+        auto end = start;
+        do {
+            run();
+            ++runs;
+            end = std::chrono::steady_clock::now();
+        } while (end - start < std::chrono::milliseconds(1));
+
+        double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / runs;
+        if (!round || nanoseconds < best) {
+            best = nanoseconds;
+        }
+    }
+    return best;
+}
+
+/// sets `threshold` to `TUNE_OFF` for the slower algorithm and to `n` for the faster one, @return the
+/// first size in `[low, high]` where the faster algorithm wins `TUNE_STREAK` times in a row.
+template <typename F>
+size_t crossover(const char *name, size_t &threshold, size_t low, size_t high, F run) {
+    size_t streak = 0, found = high;
+    for (size_t n = low; n <= high; n += n / 12 + 1) {
+        threshold = TUNE_OFF;
+        double slower = measure([&] { run(n); });
+        threshold = n;
+        double faster = measure([&] { run(n); });
+
+        if (faster < slower) {
+            if (!streak++) {
+                found = n;
+            }
+            if (streak == TUNE_STREAK) {
+                break;
+            }
+        } else {
+            streak = 0;
+            found = high;
+        }
+    }
+
+    threshold = found;
+    std::cerr << name << " : " << found << "\n";
+    return found;
+}
+
+int main() {
+    using apa::integer;
+
+    std::vector<apa::limb_t> a = operand(40000, 1), b = operand(40000, 2), out(80000);
+
+    // every algorithm above the one being tuned stays off.
+    apa::KARATSUBA_SIZE = TUNE_OFF;
+    apa::SQR_KARATSUBA_SIZE = TUNE_OFF;
+    apa::TOOM3_SIZE = TUNE_OFF;
+    apa::NTT_SIZE = TUNE_OFF;
+    apa::MUL_LOW_SIZE = TUNE_OFF;
+    apa::MUL_HIGH_SIZE = TUNE_OFF;
+    apa::KRONECKER_SIZE = TUNE_OFF;
+    apa::BURNIKEL_ZIEGLER_SIZE = TUNE_OFF;
+    apa::NEWTON_DIV_SIZE = TUNE_OFF;
+    apa::JEBELEAN_SIZE = TUNE_OFF;
+    apa::TO_STRING_DC_SIZE = TUNE_OFF;
+
+    crossover("KARATSUBA_SIZE", apa::KARATSUBA_SIZE, 8, 400, [&](size_t n) {
+        integer::mul_limbs(out.data(), n * 2, 0, a.data(), n, 0, b.data(), n, 0);
+    });
+
+    crossover("SQR_KARATSUBA_SIZE", apa::SQR_KARATSUBA_SIZE, 8, 400, [&](size_t n) {
+        integer::sqr_limbs(out.data(), n * 2, 0, a.data(), n, 0);
+    });
+
+    crossover("TOOM3_SIZE", apa::TOOM3_SIZE, apa::KARATSUBA_SIZE * 2, 3000, [&](size_t n) {
+        integer::mul_limbs(out.data(), n * 2, 0, a.data(), n, 0, b.data(), n, 0);
+    });
+
+#ifndef _BASE2_16
+    crossover("NTT_SIZE", apa::NTT_SIZE, apa::TOOM3_SIZE, 40000, [&](size_t n) {
+        integer::mul_limbs(out.data(), n * 2, 0, a.data(), n, 0, b.data(), n, 0);
+    });
+#endif
+
+    integer x(a.data(), a.size(), 0), y(b.data(), b.size(), 0);
+    crossover("MUL_LOW_SIZE", apa::MUL_LOW_SIZE, 8, 400, [&](size_t n) {
+        x.length = y.length = n;
+        apa::mul_low(x, y, n);
+    });
+
+    crossover("MUL_HIGH_SIZE", apa::MUL_HIGH_SIZE, 8, 400, [&](size_t n) {
+        x.length = y.length = n;
+        apa::mul_high(x, y, n);
+    });
+
+    // `2n` by `n` limbs, the shape every recursion level of burnikel-ziegler divides.
+    integer q, r;
+    crossover("BURNIKEL_ZIEGLER_SIZE", apa::BURNIKEL_ZIEGLER_SIZE, 8, 1000, [&](size_t n) {
+        x.length = n * 2;
+        y.length = n;
+        y.remove_leading_zeros();
+        integer::div_mod(q, r, x, y);
+    });
+
+    // exact quotients of `n` limbs by `n` limbs divisors.
+    integer product = 0;
+    size_t product_n = 0;
+    crossover("JEBELEAN_SIZE", apa::JEBELEAN_SIZE, 20, 3000, [&](size_t n) {
+        x.length = y.length = n;
+        y.remove_leading_zeros();
+        if (product_n != n) {
+            product = x * y;
+            product_n = n;
+        }
+        apa::divexact(product, y);
+    });
+
+    crossover("TO_STRING_DC_SIZE", apa::TO_STRING_DC_SIZE, 8, 400, [&](size_t n) {
+        x.length = n;
+        x.to_base10_string();
+    });
+    x.detach();
+    y.detach();
+
+    // the newton tier only pays off for huge operands, they get their own buffers.
+    std::vector<apa::limb_t> c = operand(160000, 3), d = operand(80000, 4);
+    integer u(c.data(), c.size(), 0), v(d.data(), d.size(), 0);
+    crossover("NEWTON_DIV_SIZE", apa::NEWTON_DIV_SIZE, 2000, 80000, [&](size_t n) {
+        u.length = n * 2;
+        v.length = n;
+        v.remove_leading_zeros();
+        integer::div_mod(q, r, u, v);
+    });
+    u.detach();
+    v.detach();
+
+    // polynomials with two limb coefficients, about where both sides are closest.
+    std::vector<apa::bint> coefficients(400);
+    for (size_t i = 0; i < coefficients.size(); ++i) {
+        coefficients[i] = apa::bint(apa::POSITIVE, integer({(apa::limb_t) (a[2 * i] | 1), b[2 * i + 1]}));
+    }
+    crossover("KRONECKER_SIZE", apa::KRONECKER_SIZE, 2, 200, [&](size_t n) {
+        apa::poly p(std::vector<apa::bint>(coefficients.begin(), coefficients.begin() + n));
+        p *= p;
+    });
+
+    std::cout << "#if defined(_BASE2_" << apa::LIMB_BITS << ")\n"
+              << "    #define TUNED_KARATSUBA_SIZE " << apa::KARATSUBA_SIZE << "\n"
+              << "    #define TUNED_SQR_KARATSUBA_SIZE " << apa::SQR_KARATSUBA_SIZE << "\n"
+              << "    #define TUNED_TOOM3_SIZE " << apa::TOOM3_SIZE << "\n";
+#ifndef _BASE2_16
+    std::cout << "    #define TUNED_NTT_SIZE " << apa::NTT_SIZE << "\n";
+#endif
+    std::cout << "    #define TUNED_MUL_LOW_SIZE " << apa::MUL_LOW_SIZE << "\n"
+              << "    #define TUNED_MUL_HIGH_SIZE " << apa::MUL_HIGH_SIZE << "\n"
+              << "    #define TUNED_KRONECKER_SIZE " << apa::KRONECKER_SIZE << "\n"
+              << "    #define TUNED_BURNIKEL_ZIEGLER_SIZE " << apa::BURNIKEL_ZIEGLER_SIZE << "\n"
+              << "    #define TUNED_NEWTON_DIV_SIZE " << apa::NEWTON_DIV_SIZE << "\n"
+              << "    #define TUNED_JEBELEAN_SIZE " << apa::JEBELEAN_SIZE << "\n"
+              << "    #define TUNED_TO_STRING_DC_SIZE " << apa::TO_STRING_DC_SIZE << "\n"
+              << "#endif\n";
+
+    return 0;
+}
@@ -335,6 +335,7 @@ namespace apa {
             if (cmp == EQUAL) {
                 number.length = 1;
                 number[0] = 0;
+                sign = POSITIVE;
             } else if (SIGN_NEGATIVE(sign)) {
                 if (cmp == GREAT) {
                     number = op.number - number;
@@ -385,6 +386,22 @@ namespace apa {
     }
 
     bint bint::mul_naive(const bint &op) const {
+        if (!number || !op.number) {
+            return __BINT_ZERO;
+        }
+
+        size_t len = number.length + op.number.length;
+        bint product(len, len);
+        integer::mul_basecase(
+            product.number.limbs, product.number.length, 0, number.limbs, number.length, 0, op.number.limbs,
+            op.number.length, 0
+        );
+        product.number.remove_leading_zeros();
+        product.sign = (sign == op.sign) ^ 1u;
+        return product;
+    }
+
+    bint bint::operator*(const bint &op) const {
         bint product((sign == op.sign) ^ 1u, number * op.number);
         if (!product.number) {
             product.sign = 0;
@@ -392,175 +409,36 @@ namespace apa {
         return product;
     }
 
-    bint bint::add_partial(
-        const limb_t *num1, size_t num1_len, size_t num1_index, const limb_t *num2, size_t num2_len, size_t num2_index
-    ) {
-        size_t len = std::max(num1_len, num2_len) + 1;
-        bint sum(len + 1, len);
-        std::memset(sum.number.limbs, 0x00, LIMB_BYTES * sum.number.capacity);
-
-        for (size_t i = 0; i < num1_len; ++i) {
-            sum.number.limbs[i] = num1[num1_index + i];
-        }
-
-        limb_t carry = 0;
-        for (size_t i = 0; i < num2_len; ++i) {
-            cast_t sum_index = (cast_t) sum.number.limbs[i] + num2[num2_index + i] + carry;
-            sum.number.limbs[i] = sum_index;
-            carry = sum_index >> BASE_BITS;
-        }
-
-        for (size_t i = num2_len; i < sum.number.length; ++i) {
-            cast_t sum_index = (cast_t) sum.number.limbs[i] + carry;
-            sum.number.limbs[i] = sum_index;
-            carry = sum_index >> BASE_BITS;
+    bint &bint::operator/=(const bint &op) {
+        number /= op.number;
+        sign = (sign == op.sign) ^ 1u;
+        if (!number) {
+            sign = POSITIVE;
         }
-        sum.number.limbs[sum.number.length] += carry;
-
-        sum.number.remove_leading_zeros();
-        return sum;
+        return *this;
     }
 
-    void bint::mul_karatsuba(
-        limb_t *out, size_t out_len, size_t out_index, const limb_t *num1, size_t num1_len, size_t num1_index,
-        const limb_t *num2, size_t num2_len, size_t num2_index
-    ) {
-        if (num2_len < KARATSUBA_SIZE || num1_len < KARATSUBA_SIZE) {
-            size_t i = 0, j = 0;
-            limb_t carry = 0;
-            for (j = 0; j < num1_len; ++j) {
-                cast_t product_index = (cast_t) num1[j + num1_index] * num2[num2_index] + carry;
-                out[j + out_index] = product_index;
-                carry = (product_index >> BASE_BITS);
-            }
-            out[num1_len + out_index] = carry;
-
-            for (i = 1; i < num2_len; ++i) {
-                carry = 0;
-                for (j = 0; j < num1_len; ++j) {
-                    cast_t product_index =
-                        (cast_t) num1[j + num1_index] * num2[i + num2_index] + out[i + j + out_index] + carry;
-                    out[i + j + out_index] = product_index;
-                    carry = (product_index >> BASE_BITS);
-                }
-                out[i + num1_len + out_index] = carry;
-            }
-            return;
-        }
-
-        size_t max_len = std::max(num1_len, num2_len);
-        size_t split_len = max_len - (max_len / 2);
-
-        // prep logics
-        size_t a_len, b_len, c_len, d_len;
-
-        // left hand side split
-        if (num1_len > split_len) {
-            a_len = num1_len - split_len;
-            b_len = split_len;
-        } else {
-            a_len = 0;
-            b_len = num1_len;
-        }
-
-        // right hand side split
-        if (num2_len > split_len) {
-            c_len = num2_len - split_len;
-            d_len = split_len;
-        } else {
-            c_len = 0;
-            d_len = num2_len;
-        }
-
-        // karatsuba
-
-        // z0 --------------------------------------------------------------
-        size_t z0_padding = split_len * 2;
-        if (a_len && c_len) {
-            mul_karatsuba(
-                out, out_len, out_index + z0_padding, num1, a_len, split_len + num1_index, num2, c_len,
-                split_len + num2_index
-            );
+    bint &bint::operator%=(const bint &op) {
+        number %= op.number;
+        if (!number) {
+            sign = POSITIVE;
         }
-        bint z0;
-        if (a_len && c_len) {
-            z0 = bint(out + out_index + z0_padding, a_len + c_len + 1, a_len + c_len, 0);
-        } else {
-            z0 = bint(__BINT_ZERO.number.limbs, 1, 1, 0);
-        }
-        z0.number.remove_leading_zeros();
-
-        // z1 --------------------------------------------------------------
-        mul_karatsuba(out, out_len, out_index, num1, b_len, num1_index, num2, d_len, num2_index);
-        bint z1 = bint(out + out_index, b_len + d_len + 1, b_len + d_len, 0);
-        z1.number.remove_leading_zeros();
-
-        // z2 --------------------------------------------------------------
-        bint lsplit_add, rsplit_add;
-
-        if (a_len) {
-            lsplit_add = add_partial(num1, a_len, split_len + num1_index, num1, b_len, num1_index);
-        } else {
-            lsplit_add = add_partial(__BINT_ZERO.number.limbs, 1, 0, num1, b_len, num1_index);
-        }
-
-        if (c_len) {
-            rsplit_add = add_partial(num2, c_len, split_len + num2_index, num2, d_len, num2_index);
-        } else {
-            rsplit_add = add_partial(__BINT_ZERO.number.limbs, 1, 0, num2, d_len, num2_index);
-        }
-
-        bint z2(
-            lsplit_add.number.length + rsplit_add.number.length + 1, lsplit_add.number.length + rsplit_add.number.length
-        );
-        std::memset(z2.number.limbs, 0x00, z2.number.capacity * LIMB_BYTES);
-        mul_karatsuba(
-            z2.number.limbs, z2.number.length, 0, lsplit_add.number.limbs, lsplit_add.number.length, 0,
-            rsplit_add.number.limbs, rsplit_add.number.length, 0
-        );
-        z2.number.remove_leading_zeros();
-
-        // z3 --------------------------------------------------------------
-        bint z3 = std::move(z2);
-        z3 -= z1;
-        z3 -= z0;
-        z0.detach();
-        z1.detach();
-
-        // z4 --------------------------------------------------------------
-        limb_t carry = 0;
-        for (size_t i = 0; i < z3.number.length; ++i) {
-            cast_t sum_index = (cast_t) out[i + split_len + out_index] + z3.number.limbs[i] + carry;
-            out[i + split_len + out_index] = sum_index;
-            carry = sum_index >> BASE_BITS;
-        }
-
-        // for(size_t i=out_index+split_len+z3.number.length; i < out_len; ++i) {
-        for (size_t i = out_index + split_len + z3.number.length; carry; ++i) {
-            cast_t sum_index = (cast_t) out[i] + carry;
-            out[i] = sum_index;
-            carry = sum_index >> BASE_BITS;
-        }
-        // out[out_index+split_len+z3.number.length] += carry;
+        return *this;
     }
 
-    bint bint::operator*(const bint &op) const {
-        if (number.length < KARATSUBA_SIZE || op.number.length < KARATSUBA_SIZE) {
-            return mul_naive(op);
-        }
+    bint bint::operator/(const bint &op) const {
+        bint quotient = *this;
+        return quotient /= op;
+    }
 
-        size_t len = number.length + op.number.length;
-        bint product(len + 1, len);
-        std::memset(product.number.limbs, 0x00, product.number.capacity * LIMB_BYTES);
-        mul_karatsuba(
-            product.number.limbs, product.number.length, 0, number.limbs, number.length, 0, op.number.limbs,
-            op.number.length, 0
-        );
-        product.number.remove_leading_zeros();
-        product.sign = (sign == op.sign) ^ 1u;
-        return product;
+    bint bint::operator%(const bint &op) const {
+        bint remainder = *this;
+        return remainder %= op;
     }
 
+    bint bint::square() const {
+        return bint(POSITIVE, number.square());
+    }
 
     bint bint::operator-() const {
         bint negate = *this;
@@ -669,6 +547,208 @@ namespace apa {
         b = std::move(temp);
     }
 
+    bint mul_low(const bint &a, const bint &b, size_t n) {
+        bint low((a.sign == b.sign) ^ 1u, mul_low(a.number, b.number, n));
+        if (!low.number) {
+            low.sign = POSITIVE;
+        }
+        return low;
+    }
+
+    bint mul_high(const bint &a, const bint &b, size_t n) {
+        bint high((a.sign == b.sign) ^ 1u, mul_high(a.number, b.number, n));
+        if (!high.number) {
+            high.sign = POSITIVE;
+        }
+        return high;
+    }
+
+    // a product with the sign of `acc` grows its magnitude, otherwise the magnitudes are subtracted
+    // and `acc` flips its sign when the product was the larger one.
+
+    void addmul(bint &acc, const bint &a, const bint &b) {
+        if (acc.sign == (a.sign ^ b.sign)) {
+            addmul(acc.number, a.number, b.number);
+        } else if (submul(acc.number, a.number, b.number)) {
+            acc.sign ^= 1u;
+        }
+        if (!acc.number) {
+            acc.sign = POSITIVE;
+        }
+    }
+
+    void submul(bint &acc, const bint &a, const bint &b) {
+        if (acc.sign != (a.sign ^ b.sign)) {
+            addmul(acc.number, a.number, b.number);
+        } else if (submul(acc.number, a.number, b.number)) {
+            acc.sign ^= 1u;
+        }
+        if (!acc.number) {
+            acc.sign = POSITIVE;
+        }
+    }
+
+    void addmul_1(bint &acc, const bint &a, limb_t b) {
+        if (acc.sign == a.sign) {
+            addmul_1(acc.number, a.number, b);
+        } else if (submul_1(acc.number, a.number, b)) {
+            acc.sign ^= 1u;
+        }
+        if (!acc.number) {
+            acc.sign = POSITIVE;
+        }
+    }
+
+    void submul_1(bint &acc, const bint &a, limb_t b) {
+        if (acc.sign != a.sign) {
+            addmul_1(acc.number, a.number, b);
+        } else if (submul_1(acc.number, a.number, b)) {
+            acc.sign ^= 1u;
+        }
+        if (!acc.number) {
+            acc.sign = POSITIVE;
+        }
+    }
+
+    divisor::divisor(const bint &d) : divisor(d.number) {}
+
+    void divmod(bint &q, bint &r, const bint &n, const divisor &d) {
+        limb_t sign = n.sign;
+        divmod(q.number, r.number, n.number, d);
+        q.sign = q.number ? sign : POSITIVE;
+        r.sign = r.number ? sign : POSITIVE;
+    }
+
+    bint divexact(const bint &n, const bint &d) {
+        bint q(POSITIVE, divexact(n.number, d.number));
+        if (q.number) {
+            q.sign = n.sign ^ d.sign;
+        }
+        return q;
+    }
+
+    limb_t mod_small(const bint &n, limb_t m) {
+        return mod_small(n.number, m);
+    }
+
+    void mod_small(limb_t *residues, const bint &n, const limb_t *moduli, size_t count) {
+        mod_small(residues, n.number, moduli, count);
+    }
+
+    bool divisible(const bint &n, limb_t d) {
+        return divisible(n.number, d);
+    }
+
+    // Rounding Division
+    /// `q = |n| / |d|` and `r = |n| % |d|`, when `away` is set a non zero remainder steps `q` one
+    /// further from zero and `r` becomes `|d| - r`. @return true if `q` was stepped.
+    static bool div_magnitudes(integer &q, integer &r, const integer &n, const integer &d, bool away) {
+        if (&q == &d || &r == &d) {
+            integer divisor = d;
+            return div_magnitudes(q, r, n, divisor, away);
+        }
+
+        integer::div_mod(q, r, const_cast<integer &>(n), d);
+        if (!away || !r) {
+            return false;
+        }
+
+        // `|d| - r` in place over the `d.length` limbs of the remainder.
+        if (r.capacity < d.length) {
+            r.capacity = d.length + LIMB_GROWTH;
+            r.limbs = (limb_t *) std::realloc(r.limbs, r.capacity * LIMB_BYTES);
+        }
+        std::memset(r.limbs + r.length, 0x00, (d.length - r.length) * LIMB_BYTES);
+        r.length = d.length;
+        integer::sub_n(r.limbs, d.limbs, r.limbs, d.length);
+        r.remove_leading_zeros();
+
+        ++q;
+        return true;
+    }
+
+    void tdiv_qr(bint &q, bint &r, const bint &n, const bint &d) {
+        limb_t q_sign = n.sign ^ d.sign, r_sign = n.sign;
+        div_magnitudes(q.number, r.number, n.number, d.number, false);
+        q.sign = q.number ? q_sign : POSITIVE;
+        r.sign = r.number ? r_sign : POSITIVE;
+    }
+
+    void fdiv_qr(bint &q, bint &r, const bint &n, const bint &d) {
+        limb_t q_sign = n.sign ^ d.sign, r_sign = n.sign, d_sign = d.sign;
+        if (div_magnitudes(q.number, r.number, n.number, d.number, q_sign == NEGATIVE)) {
+            r_sign = d_sign;
+        }
+        q.sign = q.number ? q_sign : POSITIVE;
+        r.sign = r.number ? r_sign : POSITIVE;
+    }
+
+    void cdiv_qr(bint &q, bint &r, const bint &n, const bint &d) {
+        limb_t q_sign = n.sign ^ d.sign, r_sign = n.sign, d_sign = d.sign;
+        if (div_magnitudes(q.number, r.number, n.number, d.number, q_sign == POSITIVE)) {
+            r_sign = d_sign ^ 1u;
+        }
+        q.sign = q.number ? q_sign : POSITIVE;
+        r.sign = r.number ? r_sign : POSITIVE;
+    }
+
+    void ediv_qr(bint &q, bint &r, const bint &n, const bint &d) {
+        limb_t q_sign = n.sign ^ d.sign, r_sign = n.sign;
+        if (div_magnitudes(q.number, r.number, n.number, d.number, r_sign == NEGATIVE)) {
+            r_sign = POSITIVE;
+        }
+        q.sign = q.number ? q_sign : POSITIVE;
+        r.sign = r.number ? r_sign : POSITIVE;
+    }
+
+    bint tdiv_q(const bint &n, const bint &d) {
+        bint q, r;
+        tdiv_qr(q, r, n, d);
+        return q;
+    }
+
+    bint fdiv_q(const bint &n, const bint &d) {
+        bint q, r;
+        fdiv_qr(q, r, n, d);
+        return q;
+    }
+
+    bint cdiv_q(const bint &n, const bint &d) {
+        bint q, r;
+        cdiv_qr(q, r, n, d);
+        return q;
+    }
+
+    bint ediv_q(const bint &n, const bint &d) {
+        bint q, r;
+        ediv_qr(q, r, n, d);
+        return q;
+    }
+
+    bint tdiv_r(const bint &n, const bint &d) {
+        bint q, r;
+        tdiv_qr(q, r, n, d);
+        return r;
+    }
+
+    bint fdiv_r(const bint &n, const bint &d) {
+        bint q, r;
+        fdiv_qr(q, r, n, d);
+        return r;
+    }
+
+    bint cdiv_r(const bint &n, const bint &d) {
+        bint q, r;
+        cdiv_qr(q, r, n, d);
+        return r;
+    }
+
+    bint ediv_r(const bint &n, const bint &d) {
+        bint q, r;
+        ediv_qr(q, r, n, d);
+        return r;
+    }
+
     // IO Operators
     std::ostream &operator<<(std::ostream &out, const bint &num) {
         out << num.to_base16_string();
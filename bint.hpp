@@ -51,19 +51,6 @@ namespace apa {
 
         // static void bitwise_prepare(bint &left, bint &right);
 
-        static bint add_partial(
-            const limb_t *l, size_t l_len, size_t l_index, const limb_t *r, size_t r_len, size_t r_index
-        );
-
-        // static void sub_partial(
-        //     limb_t *output, size_t out_len, size_t out_index, const limb_t *m, size_t m_len, size_t m_index
-        // );
-
-        static void mul_karatsuba(
-            limb_t *output, size_t out_len, size_t out_index, const limb_t *l, size_t l_len, size_t l_index,
-            const limb_t *r, size_t r_len, size_t r_index
-        );
-
         public:
 
         // Constructors
@@ -122,14 +109,58 @@ namespace apa {
         bint &operator-=(const bint &op);
         bint &operator*=(const bint &op);
 
+        /// C-style truncated division, the quotient is rounded toward zero.
+        bint &operator/=(const bint &op);
+
+        /// C-style remainder, it takes the sign of the dividend.
+        bint &operator%=(const bint &op);
+
         bint operator+(const bint &op) const;
         bint operator-(const bint &op) const;
         bint operator*(const bint &op) const;
+        bint operator/(const bint &op) const;
+        bint operator%(const bint &op) const;
 
         bint operator-() const;
 
+        /// `*this /= D` rounded toward zero, @return the magnitude of the remainder, whose sign is the
+        /// sign of the dividend. The constants of `D` are folded at compile time.
+        template <limb_t D>
+        limb_t divrem_by();
+
+        /// @return returns the magnitude of `*this % D`.
+        template <limb_t D>
+        limb_t mod_by() const;
+
+        /// @return returns the square of the number, the result is never negative.
+        bint square() const;
+
         bint mul_naive(const bint &op) const;
 
+        friend bint mul_low(const bint &a, const bint &b, size_t n);
+        friend bint mul_high(const bint &a, const bint &b, size_t n);
+        friend void addmul(bint &acc, const bint &a, const bint &b);
+        friend void submul(bint &acc, const bint &a, const bint &b);
+        friend void addmul_1(bint &acc, const bint &a, limb_t b);
+        friend void submul_1(bint &acc, const bint &a, limb_t b);
+        friend void divmod(bint &q, bint &r, const bint &n, const divisor &d);
+        friend class divisor;
+        friend bint divexact(const bint &n, const bint &d);
+        friend limb_t mod_small(const bint &n, limb_t m);
+        friend void mod_small(limb_t *residues, const bint &n, const limb_t *moduli, size_t count);
+        friend bool divisible(const bint &n, limb_t d);
+        friend void tdiv_qr(bint &q, bint &r, const bint &n, const bint &d);
+        friend void fdiv_qr(bint &q, bint &r, const bint &n, const bint &d);
+        friend void cdiv_qr(bint &q, bint &r, const bint &n, const bint &d);
+        friend void ediv_qr(bint &q, bint &r, const bint &n, const bint &d);
+
+        friend bint kronecker_pack(const std::vector<bint> &coefficients, size_t slot_bits);
+        friend std::vector<bint> kronecker_unpack(const bint &packed, size_t count, size_t slot_bits);
+
+        friend class barrett_context;
+        friend class montgomery_context;
+        friend class modint;
+
         // pre-fix increment/decrement
         bint &operator++();
         bint &operator--();
@@ -168,6 +199,82 @@ namespace apa {
     // functions
     void swap(bint &a, bint &b);
 
+    /// @return returns the low `n` limbs of `|a * b|` with the sign of the product.
+    bint mul_low(const bint &a, const bint &b, size_t n);
+
+    /// @return returns `|a * b| / B^n` with the sign of the product, rounded toward zero.
+    bint mul_high(const bint &a, const bint &b, size_t n);
+
+    /// `acc += a * b`, the partial products are accumulated straight into `acc`.
+    void addmul(bint &acc, const bint &a, const bint &b);
+
+    /// `acc -= a * b`, the partial products are accumulated straight into `acc`.
+    void submul(bint &acc, const bint &a, const bint &b);
+
+    /// `acc += a * b` for a single unsigned limb `b`.
+    void addmul_1(bint &acc, const bint &a, limb_t b);
+
+    /// `acc -= a * b` for a single unsigned limb `b`.
+    void submul_1(bint &acc, const bint &a, limb_t b);
+
+    /// `q = n / d` and `r = n % d` for the positive prepared divisor `d`, rounded toward zero like
+    /// `operator/` so `q` and `r` take the sign of `n`.
+    void divmod(bint &q, bint &r, const bint &n, const divisor &d);
+
+    /// @return returns `n / d` for a `d` that is known to divide `n`, see `divexact` of `integer`.
+    bint divexact(const bint &n, const bint &d);
+
+    /// @return returns the magnitude of `n % m`, see `mod_small` of `integer`.
+    limb_t mod_small(const bint &n, limb_t m);
+
+    /// `residues[i]` is the magnitude of `n % moduli[i]`, see `mod_small` of `integer`.
+    void mod_small(limb_t *residues, const bint &n, const limb_t *moduli, size_t count);
+
+    /// @return returns true if `d` divides `n`, see `divisible` of `integer`.
+    bool divisible(const bint &n, limb_t d);
+
+    // Rounding Division
+    // - `n = q * d + r` with `|r| < |d|` in every mode, the modes only differ in the direction `q` is
+    //   rounded and so in the sign of `r`. The magnitudes are divided once and a non zero remainder
+    //   moves `q` one step away from zero in place when the mode asks for it.
+    // - `q` or `r` may be `n` or `d` itself, throws `std::domain_error` when `d` is zero.
+
+    /// `q` rounded toward zero like `operator/` and `operator%`, `r` takes the sign of `n`.
+    void tdiv_qr(bint &q, bint &r, const bint &n, const bint &d);
+
+    /// `q` rounded toward negative infinity like python's `//` and `%`, `r` takes the sign of `d`.
+    void fdiv_qr(bint &q, bint &r, const bint &n, const bint &d);
+
+    /// `q` rounded toward positive infinity, `r` takes the opposite sign of `d`.
+    void cdiv_qr(bint &q, bint &r, const bint &n, const bint &d);
+
+    /// Euclidean division, `r` is never negative.
+    void ediv_qr(bint &q, bint &r, const bint &n, const bint &d);
+
+    bint tdiv_q(const bint &n, const bint &d);
+    bint fdiv_q(const bint &n, const bint &d);
+    bint cdiv_q(const bint &n, const bint &d);
+    bint ediv_q(const bint &n, const bint &d);
+
+    bint tdiv_r(const bint &n, const bint &d);
+    bint fdiv_r(const bint &n, const bint &d);
+    bint cdiv_r(const bint &n, const bint &d);
+    bint ediv_r(const bint &n, const bint &d);
+
+    template <limb_t D>
+    limb_t bint::divrem_by() {
+        limb_t remainder = number.divrem_by<D>();
+        if (!number) {
+            sign = POSITIVE;
+        }
+        return remainder;
+    }
+
+    template <limb_t D>
+    limb_t bint::mod_by() const {
+        return number.mod_by<D>();
+    }
+
     // IO Operators
     std::ostream &operator<<(std::ostream &out, const bint &num);
     std::istream &operator>>(std::istream &in, bint &num);
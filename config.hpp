@@ -60,13 +60,125 @@
     #endif
 #endif
 
+// `make tune` writes the crossovers measured on the host into tuned_thresholds.hpp, the defaults
+// below are kept for every threshold it does not define.
+#if !defined(_APA_TESTING_PHASE) && defined(__has_include)
+    #if __has_include("tuned_thresholds.hpp")
+        #include "tuned_thresholds.hpp"
+    #endif
+#endif
+
+#ifndef TUNED_KARATSUBA_SIZE
+    #define TUNED_KARATSUBA_SIZE 62
+#endif
+#ifndef TUNED_SQR_KARATSUBA_SIZE
+    #define TUNED_SQR_KARATSUBA_SIZE 62
+#endif
+#ifndef TUNED_TOOM3_SIZE
+    #define TUNED_TOOM3_SIZE 350
+#endif
+#ifndef TUNED_NTT_SIZE
+    #ifdef _BASE2_64
+        #define TUNED_NTT_SIZE 6000
+    #else
+        #define TUNED_NTT_SIZE 3000
+    #endif
+#endif
+#ifndef TUNED_MUL_LOW_SIZE
+    #define TUNED_MUL_LOW_SIZE 40
+#endif
+#ifndef TUNED_MUL_HIGH_SIZE
+    #define TUNED_MUL_HIGH_SIZE 40
+#endif
+#ifndef TUNED_KRONECKER_SIZE
+    #define TUNED_KRONECKER_SIZE 8
+#endif
+#ifndef TUNED_BURNIKEL_ZIEGLER_SIZE
+    #define TUNED_BURNIKEL_ZIEGLER_SIZE 160
+#endif
+#ifndef TUNED_NEWTON_DIV_SIZE
+    #define TUNED_NEWTON_DIV_SIZE 50000
+#endif
+#ifndef TUNED_JEBELEAN_SIZE
+    #define TUNED_JEBELEAN_SIZE 400
+#endif
+#ifndef TUNED_TO_STRING_DC_SIZE
+    #define TUNED_TO_STRING_DC_SIZE 40
+#endif
+
+// the tuning program moves the thresholds at run time.
+#ifdef _APA_TUNING
+    #define APA_THRESHOLD static size_t
+#else
+    #define APA_THRESHOLD static const size_t
+#endif
+
+#if (__clang__ || __GNUC__ || __GNUG__)
+    #define APA_FORCE_INLINE inline __attribute__((always_inline))
+#else
+    #define APA_FORCE_INLINE inline
+#endif
+
 namespace apa {
 
 #ifdef _APA_TESTING_PHASE
     static const size_t KARATSUBA_SIZE = 4;
+    static const size_t SQR_KARATSUBA_SIZE = 4;
+    static const size_t TOOM3_SIZE = 12;
+    static const size_t UNBALANCED_RATIO = 2;
+    static const size_t NTT_SIZE = 32;
+    static const size_t MUL_LOW_SIZE = 4;
+    static const size_t MUL_HIGH_SIZE = 4;
+    static const size_t PARALLEL_SIZE = 8;
+    static const size_t KRONECKER_SIZE = 4;
+    static const size_t BURNIKEL_ZIEGLER_SIZE = 6;
+    static const size_t NEWTON_DIV_SIZE = 48;
+    static const size_t JEBELEAN_SIZE = 6;
+    static const size_t TO_STRING_DC_SIZE = 4;
 #else
     // most efficient limb size where karatsuba should activate.
-    static const size_t KARATSUBA_SIZE = 62;
+    APA_THRESHOLD KARATSUBA_SIZE = TUNED_KARATSUBA_SIZE;
+
+    // most efficient limb size where karatsuba squaring should activate.
+    APA_THRESHOLD SQR_KARATSUBA_SIZE = TUNED_SQR_KARATSUBA_SIZE;
+
+    // most efficient limb size where toom-3 should activate.
+    APA_THRESHOLD TOOM3_SIZE = TUNED_TOOM3_SIZE;
+
+    // operand length ratio where the longer operand is sliced into blocks of the shorter one.
+    static const size_t UNBALANCED_RATIO = 2;
+
+    // most efficient limb size where the number-theoretic transform should activate,
+    // not available with base 2^16 limbs.
+    APA_THRESHOLD NTT_SIZE = TUNED_NTT_SIZE;
+
+    // most efficient limb size where the low short product splits off a full block product.
+    APA_THRESHOLD MUL_LOW_SIZE = TUNED_MUL_LOW_SIZE;
+
+    // most efficient limb size where the high short product splits off a full block product.
+    APA_THRESHOLD MUL_HIGH_SIZE = TUNED_MUL_HIGH_SIZE;
+
+    // default smallest limb size of a sub-product that runs as its own task with `set_threads`.
+    static const size_t PARALLEL_SIZE = 1024;
+
+    // fewest coefficients of the shorter polynomial where kronecker substitution replaces the
+    // coefficient by coefficient product.
+    APA_THRESHOLD KRONECKER_SIZE = TUNED_KRONECKER_SIZE;
+
+    // most efficient limb size of both divisor and quotient where the burnikel-ziegler recursive
+    // division should activate, at least 4.
+    APA_THRESHOLD BURNIKEL_ZIEGLER_SIZE = TUNED_BURNIKEL_ZIEGLER_SIZE;
+
+    // most efficient limb size of both divisor and quotient where the division by a newton reciprocal
+    // should activate, at least 8.
+    APA_THRESHOLD NEWTON_DIV_SIZE = TUNED_NEWTON_DIV_SIZE;
+
+    // most efficient limb size of both divisor and quotient where the exact division runs from both
+    // ends of the dividend.
+    APA_THRESHOLD JEBELEAN_SIZE = TUNED_JEBELEAN_SIZE;
+
+    // most efficient limb size where the decimal conversion splits the integer by powers of ten.
+    APA_THRESHOLD TO_STRING_DC_SIZE = TUNED_TO_STRING_DC_SIZE;
 #endif
 
 // 'cast_t' should always be double the size of 'limb_t', this is to avoid
@@ -16,5 +16,9 @@
 #include "integer.hpp"
 #include "math.cpp"
 #include "math.hpp"
+#include "modular.cpp"
+#include "modular.hpp"
+#include "poly.cpp"
+#include "poly.hpp"
 
 #endif
\ No newline at end of file
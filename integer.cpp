@@ -1,10 +1,20 @@
 #ifndef APA_INTEGER_CPP
 #define APA_INTEGER_CPP
 
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 #include "integer.hpp"
 
+#if defined(__x86_64__) && (__clang__ || __GNUC__)
+    #include <immintrin.h>
+#endif
+
 template <typename T1, typename T2>
 struct get_initial_capacity {
     private:
@@ -248,33 +258,158 @@ namespace apa {
         return (length == 1 && !limbs[0]) ^ 1u;
     }
 
-    // Arithmetic Operators
+    // Fixed Size Kernels
+    // - unrolled through template recursion for operands of at most `FIXED_LIMBS` limbs, `l` has
+    //   `N` limbs and `r` has `M` limbs.
 
-    integer &integer::operator+=(const integer &op) noexcept {
-        if (capacity <= op.length + 1) {
-            capacity = op.length + LIMB_GROWTH;
-            limbs = (limb_t *) std::realloc(limbs, capacity * LIMB_BYTES);
+    typedef void (*fixed_mul_kernel)(limb_t *out, const limb_t *l, const limb_t *r);
+    typedef limb_t (*fixed_add_kernel)(limb_t *out, const limb_t *l, const limb_t *r);
+
+    /// three limb accumulator of a comba multiplication column.
+    struct comba_column {
+        limb_t c0, c1, c2;
+
+        APA_FORCE_INLINE void add_product(limb_t l, limb_t r) {
+            cast_t product = (cast_t) l * r;
+            limb_t lo = product, hi = product >> BASE_BITS;
+            c0 += lo;
+            hi += c0 < lo; // the high half of a product is at most BASE_MAX - 1.
+            c1 += hi;
+            c2 += c1 < hi;
         }
 
-        if (length == capacity) {
-            capacity = length + LIMB_GROWTH;
-            limbs = (limb_t *) std::realloc(limbs, capacity * LIMB_BYTES);
-            limbs[length++] = 0;
+        APA_FORCE_INLINE limb_t shift() {
+            limb_t low = c0;
+            c0 = c1;
+            c1 = c2;
+            c2 = 0;
+            return low;
+        }
+    };
+
+    /// accumulates the products `l[I] * r[K - I]` of column `K`.
+    template <size_t N, size_t M, size_t K, size_t I, bool = (I < N && I <= K)>
+    struct comba_terms {
+        APA_FORCE_INLINE static void run(comba_column &column, const limb_t *l, const limb_t *r) {
+            column.add_product(l[I], r[K - I]);
+            comba_terms<N, M, K, I + 1>::run(column, l, r);
         }
+    };
+
+    template <size_t N, size_t M, size_t K, size_t I>
+    struct comba_terms<N, M, K, I, false> {
+        APA_FORCE_INLINE static void run(comba_column &, const limb_t *, const limb_t *) {}
+    };
+
+    /// writes the product limbs from column `K` onward.
+    template <size_t N, size_t M, size_t K, bool = (K + 1 < N + M)>
+    struct comba_columns {
+        APA_FORCE_INLINE static void run(limb_t *out, comba_column &column, const limb_t *l, const limb_t *r) {
+            comba_terms<N, M, K, (K < M ? 0 : K - M + 1)>::run(column, l, r);
+            out[K] = column.shift();
+            comba_columns<N, M, K + 1>::run(out, column, l, r);
+        }
+    };
 
-        if (length <= op.length) {
-            std::memset(limbs + length, 0x00, ((op.length + 1) - length) * LIMB_BYTES);
-            length = op.length + 1;
+    template <size_t N, size_t M, size_t K>
+    struct comba_columns<N, M, K, false> {
+        APA_FORCE_INLINE static void run(limb_t *out, comba_column &column, const limb_t *, const limb_t *) {
+            out[K] = column.c0;
+        }
+    };
+
+    /// adds or subtracts limb `I` and onward, `r` is treated as zero past its `M` limbs.
+    template <size_t N, size_t M, size_t I, bool = (I < N)>
+    struct fixed_limbs {
+        APA_FORCE_INLINE static limb_t add(limb_t *out, const limb_t *l, const limb_t *r, limb_t carry) {
+            cast_t sum = (cast_t) l[I] + (I < M ? r[I] : 0) + carry;
+            out[I] = sum;
+            return fixed_limbs<N, M, I + 1>::add(out, l, r, sum >> BASE_BITS);
         }
 
-        limb_t carry = 0;
+        APA_FORCE_INLINE static limb_t sub(limb_t *out, const limb_t *l, const limb_t *r, limb_t carry) {
+            cast_t dif = (cast_t) l[I] - (I < M ? r[I] : 0) - carry;
+            out[I] = dif;
+            return fixed_limbs<N, M, I + 1>::sub(out, l, r, (dif >> BASE_BITS) & 0x01);
+        }
+    };
 
-        for (size_t i = 0; i < op.length; ++i) {
-            cast_t sum = (cast_t) limbs[i] + op.limbs[i] + carry;
-            limbs[i] = sum;
-            carry = sum >> BASE_BITS;
+    template <size_t N, size_t M, size_t I>
+    struct fixed_limbs<N, M, I, false> {
+        APA_FORCE_INLINE static limb_t add(limb_t *, const limb_t *, const limb_t *, limb_t carry) {
+            return carry;
+        }
+
+        APA_FORCE_INLINE static limb_t sub(limb_t *, const limb_t *, const limb_t *, limb_t carry) {
+            return carry;
+        }
+    };
+
+    /// comba multiplication, writes `N + M` limbs.
+    template <size_t N, size_t M>
+    static void fixed_mul(limb_t *out, const limb_t *l, const limb_t *r) {
+        comba_column column = {0, 0, 0};
+        comba_columns<N, M, 0>::run(out, column, l, r);
+    }
+
+    /// writes `N` limbs where `M <= N`, @return the carry out.
+    template <size_t N, size_t M>
+    static limb_t fixed_add(limb_t *out, const limb_t *l, const limb_t *r) {
+        return fixed_limbs<N, M, 0>::add(out, l, r, 0);
+    }
+
+    /// writes `N` limbs where `M <= N`, @return the borrow out.
+    template <size_t N, size_t M>
+    static limb_t fixed_sub(limb_t *out, const limb_t *l, const limb_t *r) {
+        return fixed_limbs<N, M, 0>::sub(out, l, r, 0);
+    }
+
+// jump table row of a kernel for `N` limbs, the `r` lengths are clamped to `M_MAX`.
+#define FIXED_MIN(A, B) ((A) < (B) ? (A) : (B))
+#define FIXED_ROW(KERNEL, N, M_MAX)                                                                               \
+    {                                                                                                             \
+        &KERNEL<N, FIXED_MIN(1, M_MAX)>, &KERNEL<N, FIXED_MIN(2, M_MAX)>, &KERNEL<N, FIXED_MIN(3, M_MAX)>,        \
+            &KERNEL<N, FIXED_MIN(4, M_MAX)>, &KERNEL<N, FIXED_MIN(5, M_MAX)>, &KERNEL<N, FIXED_MIN(6, M_MAX)>,    \
+            &KERNEL<N, FIXED_MIN(7, M_MAX)>, &KERNEL<N, FIXED_MIN(8, M_MAX)>                                      \
+    }
+
+    /// indexed by `[N - 1][M - 1]`.
+    static const fixed_mul_kernel FIXED_MUL[FIXED_LIMBS][FIXED_LIMBS] = {
+        FIXED_ROW(fixed_mul, 1, 8), FIXED_ROW(fixed_mul, 2, 8), FIXED_ROW(fixed_mul, 3, 8),
+        FIXED_ROW(fixed_mul, 4, 8), FIXED_ROW(fixed_mul, 5, 8), FIXED_ROW(fixed_mul, 6, 8),
+        FIXED_ROW(fixed_mul, 7, 8), FIXED_ROW(fixed_mul, 8, 8)};
+
+    /// indexed by `[N - 1][M - 1]` where `M <= N`.
+    static const fixed_add_kernel FIXED_ADD[FIXED_LIMBS][FIXED_LIMBS] = {
+        FIXED_ROW(fixed_add, 1, 1), FIXED_ROW(fixed_add, 2, 2), FIXED_ROW(fixed_add, 3, 3),
+        FIXED_ROW(fixed_add, 4, 4), FIXED_ROW(fixed_add, 5, 5), FIXED_ROW(fixed_add, 6, 6),
+        FIXED_ROW(fixed_add, 7, 7), FIXED_ROW(fixed_add, 8, 8)};
+
+    /// indexed by `[N - 1][M - 1]` where `M <= N`.
+    static const fixed_add_kernel FIXED_SUB[FIXED_LIMBS][FIXED_LIMBS] = {
+        FIXED_ROW(fixed_sub, 1, 1), FIXED_ROW(fixed_sub, 2, 2), FIXED_ROW(fixed_sub, 3, 3),
+        FIXED_ROW(fixed_sub, 4, 4), FIXED_ROW(fixed_sub, 5, 5), FIXED_ROW(fixed_sub, 6, 6),
+        FIXED_ROW(fixed_sub, 7, 7), FIXED_ROW(fixed_sub, 8, 8)};
+
+#undef FIXED_ROW
+#undef FIXED_MIN
+
+    // Arithmetic Operators
+
+    integer &integer::operator+=(const integer &op) noexcept {
+        // one extra limb for the final carry.
+        size_t sum_len = std::max(length, op.length) + 1;
+
+        if (capacity < sum_len) {
+            capacity = sum_len + LIMB_GROWTH;
+            limbs = (limb_t *) std::realloc(limbs, capacity * LIMB_BYTES);
         }
 
+        std::memset(limbs + length, 0x00, (sum_len - length) * LIMB_BYTES);
+        length = sum_len;
+
+        limb_t carry = add_n(limbs, limbs, op.limbs, op.length);
+
         for (size_t i = op.length; i < length; ++i) {
             cast_t sum = (cast_t) limbs[i] + carry;
             limbs[i] = sum;
@@ -304,16 +439,16 @@ namespace apa {
         limb_t *sum_array = (limb_t *) std::malloc(LIMB_BYTES * (max_len + 1));
         limb_t carry = 0;
 
-        for (size_t i = 0; i < min_len; ++i) {
-            cast_t sum = (cast_t) max_limb[i] + min_limb[i] + carry;
-            sum_array[i] = sum;
-            carry = sum >> BASE_BITS;
-        }
+        if (max_len <= FIXED_LIMBS) {
+            carry = FIXED_ADD[max_len - 1][min_len - 1](sum_array, max_limb, min_limb);
+        } else {
+            carry = add_n(sum_array, max_limb, min_limb, min_len);
 
-        for (size_t i = min_len; i < max_len; ++i) {
-            cast_t sum = (cast_t) max_limb[i] + carry;
-            sum_array[i] = sum;
-            carry = sum >> BASE_BITS;
+            for (size_t i = min_len; i < max_len; ++i) {
+                cast_t sum = (cast_t) max_limb[i] + carry;
+                sum_array[i] = sum;
+                carry = sum >> BASE_BITS;
+            }
         }
 
         sum_array[max_len] = carry;
@@ -321,14 +456,7 @@ namespace apa {
     }
 
     integer &integer::operator-=(const integer &op) noexcept {
-        limb_t carry = 0;
-
-        for (size_t i = 0; i < op.length; ++i) {
-            cast_t dif_index = (cast_t) limbs[i] - op.limbs[i] - carry;
-            limbs[i] = dif_index;
-            carry = (dif_index >> BASE_BITS);
-            carry &= 0x01;
-        }
+        limb_t carry = sub_n(limbs, limbs, op.limbs, op.length);
 
         for (size_t i = op.length; i < length; ++i) {
             cast_t dif_index = (cast_t) limbs[i] - carry;
@@ -345,20 +473,17 @@ namespace apa {
         size_t dif_len = std::max(length, op.length);
         limb_t *dif_array = (limb_t *) std::malloc(dif_len * LIMB_BYTES);
 
-        limb_t carry = 0;
-
-        for (size_t i = 0; i < op.length; ++i) {
-            cast_t dif_index = (cast_t) limbs[i] - op.limbs[i] - carry;
-            dif_array[i] = dif_index;
-            carry = (dif_index >> BASE_BITS);
-            carry &= 0x01;
-        }
+        if (length <= FIXED_LIMBS && op.length <= length) {
+            FIXED_SUB[length - 1][op.length - 1](dif_array, limbs, op.limbs);
+        } else {
+            limb_t carry = sub_n(dif_array, limbs, op.limbs, op.length);
 
-        for (size_t i = op.length; i < length; ++i) {
-            cast_t dif_index = (cast_t) limbs[i] - carry;
-            dif_array[i] = dif_index;
-            carry = (dif_index >> BASE_BITS);
-            carry &= 0x01;
+            for (size_t i = op.length; i < length; ++i) {
+                cast_t dif_index = (cast_t) limbs[i] - carry;
+                dif_array[i] = dif_index;
+                carry = (dif_index >> BASE_BITS);
+                carry &= 0x01;
+            }
         }
 
         integer dif_int(dif_array, dif_len, dif_len);
@@ -373,250 +498,2450 @@ namespace apa {
     }
 
     integer integer::operator*(const integer &op) const noexcept {
+        if (this == &op || limbs == op.limbs) {
+            return square();
+        }
+
         if ((*this && op) ^ 1u) {
             return __INTEGER_ZERO;
         }
 
-        limb_t *arr = (limb_t *) std::malloc(LIMB_BYTES * (length + op.length));
-        integer product(arr, length + op.length, length + op.length);
+        size_t len = length + op.length;
+        limb_t *arr = (limb_t *) std::malloc(LIMB_BYTES * (len + 1));
+        integer product(arr, len + 1, len);
 
-        size_t i = 0, j = 0;
-        limb_t carry = 0;
-        for (j = 0; j < length; ++j) {
-            cast_t product_index = (cast_t) limbs[j] * op.limbs[0] + carry;
-            product.limbs[j] = product_index;
-            carry = (product_index >> BASE_BITS);
+        if (length <= FIXED_LIMBS && op.length <= FIXED_LIMBS) {
+            FIXED_MUL[length - 1][op.length - 1](product.limbs, limbs, op.limbs);
+        } else {
+            mul_limbs(product.limbs, product.length, 0, limbs, length, 0, op.limbs, op.length, 0);
         }
-        product.limbs[length] = carry;
 
-        for (i = 1; i < op.length; ++i) {
-            carry = 0;
-            for (j = 0; j < length; ++j) {
-                cast_t product_index = (cast_t) limbs[j] * op.limbs[i] + product.limbs[i + j] + carry;
-                product.limbs[i + j] = product_index;
-                carry = (product_index >> BASE_BITS);
-            }
-            product.limbs[i + length] = carry;
+        product.length -= !product.limbs[product.length - 1];
+        return product;
+    }
+
+    integer integer::square() const noexcept {
+        if (!*this) {
+            return __INTEGER_ZERO;
+        }
+
+        size_t len = length * 2;
+        limb_t *arr = (limb_t *) std::malloc(LIMB_BYTES * (len + 1));
+        integer product(arr, len + 1, len);
+
+        if (length <= FIXED_LIMBS) {
+            FIXED_MUL[length - 1][length - 1](product.limbs, limbs, limbs);
+        } else {
+            sqr_limbs(product.limbs, product.length, 0, limbs, length, 0);
         }
 
         product.length -= !product.limbs[product.length - 1];
         return product;
     }
 
+    // Limb Kernels
+    // - the portable kernels are always available, with base 2^64 limbs on x86-64 the BMI2/ADX
+    //   kernels are selected once on first use when the host cpu supports them.
 
-    void div_n_by_1(limb_t *quotient, limb_t *dividen, size_t length, limb_t divisor) {
-        cast_t remainder = 0;
-        
-        remainder = dividen[length - 1] % divisor;
-        remainder <<= BASE_BITS;
-        quotient[length - 1] = dividen[length - 1] / divisor;
+    static limb_t addmul_1_portable(limb_t *out, const limb_t *l, size_t n, limb_t r) {
+        limb_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            cast_t product_index = (cast_t) l[i] * r + out[i] + carry;
+            out[i] = product_index;
+            carry = product_index >> BASE_BITS;
+        }
+        return carry;
+    }
 
-        for (size_t i = 1; i < length; ++i) {
-            remainder |= dividen[length - 1 - i];
-            quotient[length - 1 - i] = remainder / divisor;
-            remainder = (remainder % divisor) << BASE_BITS;
+    static limb_t add_n_portable(limb_t *out, const limb_t *l, const limb_t *r, size_t n) {
+        limb_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            cast_t sum_index = (cast_t) l[i] + r[i] + carry;
+            out[i] = sum_index;
+            carry = sum_index >> BASE_BITS;
+        }
+        return carry;
+    }
+
+    static limb_t sub_n_portable(limb_t *out, const limb_t *l, const limb_t *r, size_t n) {
+        limb_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            cast_t dif_index = (cast_t) l[i] - r[i] - carry;
+            out[i] = dif_index;
+            carry = (dif_index >> BASE_BITS) & 0x01;
         }
+        return carry;
     }
 
-    void div_n_by_m(limb_t *quotient, const integer& dividen, const integer& divisor) {
-        integer remainder(dividen.length, dividen.length);
-        remainder.length = 1;
-        remainder.limbs[0] = 0;
+#if defined(_BASE2_64) && defined(__x86_64__) && (__clang__ || __GNUC__) && !defined(_APA_PORTABLE_KERNELS)
+    #define APA_ADX_KERNELS
 
-        limb_t bit = 0, current_index = dividen.length, onebit = 1;
-        size_t total_bits = dividen.length * BASE_BITS;
-        
-        for (size_t h = 0; h < total_bits; h += BASE_BITS) {
-            remainder <<= BASE_BITS;
-            remainder.limbs[0] = dividen.limbs[--current_index];
-            quotient[current_index] = 0;
+    // the loops index from `-n` up to zero, `inc` keeps the carry flag (CF) while `lea` and `jrcxz`
+    // also keep the overflow flag (OF).
+
+    /// `mulx` with two carry chains : `adcx` (CF) adds the previous high half and `adox` (OF)
+    /// adds the output limb.
+    static limb_t addmul_1_adx(limb_t *out, const limb_t *l, size_t n, limb_t r) {
+        if (!n) {
+            return 0;
+        }
 
-            if (remainder >= divisor) {
-                limb_t r = remainder.limbs[0];
-                remainder >>= BASE_BITS;
+        limb_t carry, lo, hi;
+        size_t i = -n;
+        __asm__(
+            "xorl %k[carry], %k[carry]\n\t"
+            "1:\n\t"
+            "mulx (%[l], %[i], 8), %[lo], %[hi]\n\t"
+            "adcx %[carry], %[lo]\n\t"
+            "adox (%[out], %[i], 8), %[lo]\n\t"
+            "movq %[lo], (%[out], %[i], 8)\n\t"
+            "movq %[hi], %[carry]\n\t"
+            "leaq 1(%[i]), %[i]\n\t"
+            "jrcxz 2f\n\t"
+            "jmp 1b\n\t"
+            "2:\n\t"
+            "movl $0, %k[lo]\n\t"
+            "adcx %[lo], %[carry]\n\t"
+            "adox %[lo], %[carry]\n\t"
+            : [carry] "=&r"(carry), [lo] "=&r"(lo), [hi] "=&r"(hi), [i] "+c"(i)
+            : [out] "r"(out + n), [l] "r"(l + n), "d"(r)
+            : "cc", "memory"
+        );
+        return carry;
+    }
 
-                for (size_t i = 0; i < BASE_BITS; ++i) {
-                    bit = (r << i);
-                    bit >>= BASE_BITS_MINUS1;
+    static limb_t add_n_adx(limb_t *out, const limb_t *l, const limb_t *r, size_t n) {
+        if (!n) {
+            return 0;
+        }
 
-                    remainder <<= 1;
-                    remainder.limbs[0] |= bit;
+        limb_t sum;
+        size_t i = -n;
+        __asm__(
+            "xorl %k[sum], %k[sum]\n\t"
+            "1:\n\t"
+            "movq (%[l], %[i], 8), %[sum]\n\t"
+            "adcx (%[r], %[i], 8), %[sum]\n\t"
+            "movq %[sum], (%[out], %[i], 8)\n\t"
+            "incq %[i]\n\t"
+            "jnz 1b\n\t"
+            "setc %b[sum]\n\t"
+            "movzbl %b[sum], %k[sum]\n\t"
+            : [sum] "=&r"(sum), [i] "+r"(i)
+            : [out] "r"(out + n), [l] "r"(l + n), [r] "r"(r + n)
+            : "cc", "memory"
+        );
+        return sum;
+    }
 
-                    if (remainder >= divisor) {
-                        remainder -= divisor;
-                        quotient[current_index] |= (onebit << (BASE_BITS_MINUS1 - i));
-                    }
-                }
+    static limb_t sub_n_adx(limb_t *out, const limb_t *l, const limb_t *r, size_t n) {
+        if (!n) {
+            return 0;
+        }
+
+        limb_t dif;
+        size_t i = -n;
+        __asm__(
+            "xorl %k[dif], %k[dif]\n\t"
+            "1:\n\t"
+            "movq (%[l], %[i], 8), %[dif]\n\t"
+            "sbbq (%[r], %[i], 8), %[dif]\n\t"
+            "movq %[dif], (%[out], %[i], 8)\n\t"
+            "incq %[i]\n\t"
+            "jnz 1b\n\t"
+            "setc %b[dif]\n\t"
+            "movzbl %b[dif], %k[dif]\n\t"
+            : [dif] "=&r"(dif), [i] "+r"(i)
+            : [out] "r"(out + n), [l] "r"(l + n), [r] "r"(r + n)
+            : "cc", "memory"
+        );
+        return dif;
+    }
+#endif
+
+#if defined(_BASE2_32) && defined(__x86_64__) && (__clang__ || __GNUC__) && !defined(_APA_PORTABLE_KERNELS)
+    #define APA_SIMD32_KERNELS
+
+    // `vpmuludq` multiplies the low 32 bits of every 64 bit lane, the products are summed per output
+    // column with the low and high halves kept apart, a column takes at most `min(l_len, r_len)`
+    // additions so the carries are only normalized once per column.
+
+    /// operands up to this length widen into a stack buffer.
+    static const size_t SIMD_STACK_LEN = 512;
+
+    /// the IFMA columns are exact while the shorter operand stays below `IFMA_MAX_LEN`, below
+    /// `IFMA_MIN_LEN` the wider lanes are mostly padding.
+    static const size_t IFMA_MIN_LEN = 16;
+    static const size_t IFMA_MAX_LEN = 2048;
+
+    /// copies `l` into 64 bit lanes with `pad` zero lanes on each side, @return the first limb.
+    static uint64_t *simd_widen(uint64_t *buffer, const limb_t *l, size_t l_len, size_t pad) {
+        std::memset(buffer, 0x00, pad * sizeof(uint64_t));
+        for (size_t i = 0; i < l_len; ++i) {
+            buffer[pad + i] = l[i];
+        }
+        std::memset(buffer + pad + l_len, 0x00, pad * sizeof(uint64_t));
+        return buffer + pad;
+    }
+
+    __attribute__((target("avx2"))) static void mul_basecase_avx2(
+        limb_t *out, const limb_t *l, size_t l_len, const limb_t *r, size_t r_len
+    ) {
+        uint64_t stack[SIMD_STACK_LEN + 8];
+        uint64_t *buffer = l_len <= SIMD_STACK_LEN ? stack : (uint64_t *) std::malloc((l_len + 8) * sizeof(uint64_t));
+        const uint64_t *wide = simd_widen(buffer, l, l_len, 4);
+
+        const __m256i mask = _mm256_set1_epi64x(BASE_MAX);
+        alignas(32) uint64_t lo_cols[4], hi_cols[4];
+        uint64_t carry = 0, hi_prev = 0;
+
+        // output columns `k` to `k + 3`, lane `q` sums l[k + q - i] * r[i].
+        size_t product_len = l_len + r_len;
+        for (size_t k = 0; k < product_len; k += 4) {
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            size_t i_begin = k + 1 > l_len ? k + 1 - l_len : 0;
+            size_t i_end = std::min(r_len, k + 4);
+            for (size_t i = i_begin; i < i_end; ++i) {
+                __m256i a = _mm256_loadu_si256((const __m256i *) (wide + k - i));
+                __m256i p = _mm256_mul_epu32(a, _mm256_set1_epi32(r[i]));
+                lo = _mm256_add_epi64(lo, _mm256_and_si256(p, mask));
+                hi = _mm256_add_epi64(hi, _mm256_srli_epi64(p, BASE_BITS));
+            }
+
+            _mm256_store_si256((__m256i *) lo_cols, lo);
+            _mm256_store_si256((__m256i *) hi_cols, hi);
+            for (size_t q = 0; q < 4 && k + q < product_len; ++q) {
+                carry += lo_cols[q] + hi_prev;
+                hi_prev = hi_cols[q];
+                out[k + q] = carry;
+                carry >>= BASE_BITS;
             }
         }
+
+        if (buffer != stack) {
+            std::free(buffer);
+        }
     }
 
-    void integer::div_mod(integer& q, integer& r, integer& dividen, const integer& divisor) {
-        if (divisor.length == 1) {
-            cast_t remainder = 0;
-            limb_t onelimb_divisor = divisor[0];
-        
-            remainder = dividen.limbs[dividen.length - 1] % onelimb_divisor;
-            remainder <<= BASE_BITS;
-            q.limbs[dividen.length - 1] = dividen.limbs[dividen.length - 1] / onelimb_divisor;
+    /// `vpmadd52luq` and `vpmadd52huq` fuse the multiply and the column sum : a column is
+    /// `lo + hi * 2^52` where `hi * 2^52` carries `hi << 20` into the next column.
+    __attribute__((target("avx512f,avx512ifma"))) static void mul_basecase_ifma(
+        limb_t *out, const limb_t *l, size_t l_len, const limb_t *r, size_t r_len
+    ) {
+        uint64_t stack[SIMD_STACK_LEN + 16];
+        uint64_t *buffer = l_len <= SIMD_STACK_LEN ? stack : (uint64_t *) std::malloc((l_len + 16) * sizeof(uint64_t));
+        const uint64_t *wide = simd_widen(buffer, l, l_len, 8);
+
+        alignas(64) uint64_t lo_cols[8], hi_cols[8];
+        uint64_t carry = 0, hi_prev = 0;
+
+        size_t product_len = l_len + r_len;
+        for (size_t k = 0; k < product_len; k += 8) {
+            __m512i lo = _mm512_setzero_si512(), hi = _mm512_setzero_si512();
+            size_t i_begin = k + 1 > l_len ? k + 1 - l_len : 0;
+            size_t i_end = std::min(r_len, k + 8);
+            for (size_t i = i_begin; i < i_end; ++i) {
+                __m512i a = _mm512_loadu_si512((const void *) (wide + k - i));
+                __m512i b = _mm512_set1_epi64(r[i]);
+                lo = _mm512_madd52lo_epu64(lo, a, b);
+                hi = _mm512_madd52hi_epu64(hi, a, b);
+            }
 
-            for (size_t i = 1; i < dividen.length; ++i) {
-                remainder |= dividen.limbs[dividen.length - 1 - i];
-                q.limbs[dividen.length - 1 - i] = remainder / onelimb_divisor;
-                remainder = (remainder % onelimb_divisor) << BASE_BITS;
+            _mm512_store_si512((void *) lo_cols, lo);
+            _mm512_store_si512((void *) hi_cols, hi);
+            for (size_t q = 0; q < 8 && k + q < product_len; ++q) {
+                carry += lo_cols[q] + hi_prev;
+                hi_prev = hi_cols[q] << 20;
+                out[k + q] = carry;
+                carry >>= BASE_BITS;
             }
+        }
+
+        if (buffer != stack) {
+            std::free(buffer);
+        }
+    }
 
-            r = remainder >> BASE_BITS;
+    static void mul_basecase_ifma_bounded(limb_t *out, const limb_t *l, size_t l_len, const limb_t *r, size_t r_len) {
+        size_t min_len = std::min(l_len, r_len);
+        if (min_len >= IFMA_MIN_LEN && min_len < IFMA_MAX_LEN) {
+            mul_basecase_ifma(out, l, l_len, r, r_len);
         } else {
-            integer remainder(dividen.length, dividen.length);
-            remainder.length = 1;
-            remainder.limbs[0] = 0;
-
-            limb_t bit = 0, current_index = dividen.length, onebit = 1;
-            size_t total_bits = dividen.length * BASE_BITS;
-            
-            for (size_t h = 0; h < total_bits; h += BASE_BITS) {
-                remainder <<= BASE_BITS;
-                remainder.limbs[0] = dividen.limbs[--current_index];
-                q.limbs[current_index] = 0;
-
-                if (remainder >= divisor) {
-                    limb_t r = remainder.limbs[0];
-                    remainder >>= BASE_BITS;
-
-                    for (size_t i = 0; i < BASE_BITS; ++i) {
-                        bit = (r << i);
-                        bit >>= BASE_BITS_MINUS1;
-
-                        remainder <<= 1;
-                        remainder.limbs[0] |= bit;
-
-                        if (remainder >= divisor) {
-                            remainder -= divisor;
-                            q.limbs[current_index] |= (onebit << (BASE_BITS_MINUS1 - i));
-                        }
-                    }
-                }
-            }
+            mul_basecase_avx2(out, l, l_len, r, r_len);
+        }
+    }
+#endif
 
-            r = remainder;
+    /// schoolbook rows of `addmul_1`, writes `l_len + r_len` limbs.
+    static void mul_basecase_rows(limb_t *out, const limb_t *l, size_t l_len, const limb_t *r, size_t r_len) {
+        std::memset(out, 0x00, l_len * LIMB_BYTES);
+        for (size_t i = 0; i < r_len; ++i) {
+            out[i + l_len] = integer::addmul_1(out + i, l, l_len, r[i]);
         }
-        q.remove_leading_zeros();
     }
 
-    // pre-fix increment/decrement
-    integer &integer::operator++() noexcept {
-        return *this += __INTEGER_ONE;
+    struct limb_kernels {
+        limb_t (*addmul_1)(limb_t *out, const limb_t *l, size_t n, limb_t r);
+        limb_t (*add_n)(limb_t *out, const limb_t *l, const limb_t *r, size_t n);
+        limb_t (*sub_n)(limb_t *out, const limb_t *l, const limb_t *r, size_t n);
+        void (*mul_basecase)(limb_t *out, const limb_t *l, size_t l_len, const limb_t *r, size_t r_len);
+    };
+
+    static limb_kernels select_limb_kernels() {
+        limb_kernels kernels = {addmul_1_portable, add_n_portable, sub_n_portable, mul_basecase_rows};
+#if defined(APA_ADX_KERNELS) || defined(APA_SIMD32_KERNELS)
+        __builtin_cpu_init();
+#endif
+#ifdef APA_ADX_KERNELS
+        if (__builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx")) {
+            kernels.addmul_1 = addmul_1_adx;
+            kernels.add_n = add_n_adx;
+            kernels.sub_n = sub_n_adx;
+        }
+#endif
+#ifdef APA_SIMD32_KERNELS
+        if (__builtin_cpu_supports("avx2")) {
+            kernels.mul_basecase = mul_basecase_avx2;
+        }
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma")) {
+            kernels.mul_basecase = mul_basecase_ifma_bounded;
+        }
+#endif
+        return kernels;
     }
 
-    integer &integer::operator--() noexcept {
-        return *this -= __INTEGER_ONE;
+    /// kernels of the host cpu, a function local static so the selection is thread safe and
+    /// does not depend on the static initialization order.
+    static const limb_kernels &host_kernels() {
+        static const limb_kernels kernels = select_limb_kernels();
+        return kernels;
     }
 
-    // post-fix increment/decrement
-    integer integer::operator++(int) noexcept {
-        integer prev = *this;
-        ++*this;
-        return prev;
+    limb_t integer::addmul_1(limb_t *out, const limb_t *l, size_t n, limb_t r) noexcept {
+        return host_kernels().addmul_1(out, l, n, r);
     }
 
-    integer integer::operator--(int) noexcept {
-        integer prev = *this;
-        --*this;
-        return prev;
+    limb_t integer::add_n(limb_t *out, const limb_t *l, const limb_t *r, size_t n) noexcept {
+        return host_kernels().add_n(out, l, r, n);
     }
 
-    // Shift Operators
-    integer &integer::operator<<=(size_t bits) noexcept {
-        if (*this && bits) {
-            size_t limb_shifts = bits / BASE_BITS;
-            size_t bit_shifts = bits % BASE_BITS;
-            size_t new_length = length + limb_shifts + 1;
-            size_t zero_limbs = new_length - length - 1;
+    limb_t integer::sub_n(limb_t *out, const limb_t *l, const limb_t *r, size_t n) noexcept {
+        return host_kernels().sub_n(out, l, r, n);
+    }
 
-            if (new_length > capacity) {
-                capacity = new_length + LIMB_GROWTH;
-                limbs = (limb_t *) std::realloc(limbs, capacity * LIMB_BYTES);
+    limb_t integer::submul_1(limb_t *out, const limb_t *l, size_t n, limb_t r) noexcept {
+        limb_t borrow = 0;
+        for (size_t i = 0; i < n; ++i) {
+            cast_t product_index = (cast_t) l[i] * r + borrow;
+            limb_t low = product_index;
+            borrow = (limb_t) (product_index >> BASE_BITS) + (out[i] < low);
+            out[i] -= low;
+        }
+        return borrow;
+    }
+
+    // Thread Pool
+    // - with more than one thread the independent sub-products of karatsuba, toom-3 and the
+    //   number-theoretic transform fan out to a shared pool, every task writes its own output
+    //   range so the products are bit-identical to the sequential path.
+
+    /// a unit of work queued on the pool, `done` is guarded by the pool lock.
+    struct pool_task {
+        std::function<void()> work;
+        bool done = false;
+    };
+
+    /// the calling thread counts as one of the threads, a task that no worker picked up yet is taken
+    /// back and run by the thread that queued it, so a thread only ever blocks on a task that is
+    /// already running and nested fan outs cannot deadlock.
+    class thread_pool {
+        private:
+
+        std::mutex lock;
+        std::condition_variable queued;
+        std::condition_variable finished;
+        std::deque<pool_task *> queue;
+        std::vector<std::thread> workers;
+        bool stopping = false;
+
+        /// runs the front task, `guard` is released while the task runs.
+        void run_front(std::unique_lock<std::mutex> &guard) {
+            pool_task *task = queue.front();
+            queue.pop_front();
+            guard.unlock();
+            task->work();
+            guard.lock();
+            task->done = true;
+            finished.notify_all();
+        }
+
+        void work_loop() {
+            std::unique_lock<std::mutex> guard(lock);
+            for (;;) {
+                queued.wait(guard, [this] { return stopping || !queue.empty(); });
+                if (queue.empty()) {
+                    return;
+                }
+                run_front(guard);
             }
+        }
 
-            limbs[new_length - 1] = 0;
+        void stop() {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stopping = true;
+            }
+            queued.notify_all();
+            for (auto &worker: workers) {
+                worker.join();
+            }
+            workers.clear();
+            stopping = false;
+        }
 
-            for (size_t i = 0; i < length; ++i) {
-                cast_t temp_shift = limbs[length - 1 - i];
-                temp_shift <<= bit_shifts;
-                limbs[new_length - 1 - i] |= temp_shift >> BASE_BITS;
-                limbs[new_length - 2 - i] = temp_shift;
+        public:
+
+        ~thread_pool() {
+            stop();
+        }
+
+        void resize(size_t threads) {
+            stop();
+            for (size_t i = 1; i < threads; ++i) {
+                workers.emplace_back(&thread_pool::work_loop, this);
             }
+        }
 
-            if (zero_limbs) {
-                std::memset(limbs, 0x00, zero_limbs * LIMB_BYTES);
+        void submit(pool_task *task) {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                queue.push_back(task);
             }
+            queued.notify_one();
+        }
 
-            length = new_length;
-            length -= !limbs[length - 1];
+        /// @return true if `task` was still queued, it is then removed and left to the caller.
+        bool take(pool_task *task) {
+            std::lock_guard<std::mutex> guard(lock);
+            auto queued_task = std::find(queue.begin(), queue.end(), task);
+            if (queued_task == queue.end()) {
+                return false;
+            }
+            queue.erase(queued_task);
+            return true;
         }
-        return *this;
+
+        void wait(pool_task *task) {
+            std::unique_lock<std::mutex> guard(lock);
+            finished.wait(guard, [task] { return task->done; });
+        }
+    };
+
+    static std::atomic<size_t> pool_threads(1);
+    static std::atomic<size_t> pool_min_size(PARALLEL_SIZE);
+
+    static thread_pool &shared_pool() {
+        static thread_pool pool;
+        return pool;
     }
 
-    integer &integer::operator>>=(size_t bits) noexcept {
-        if (*this && bits) {
-            size_t limb_shifts = bits / BASE_BITS;
-            if (limb_shifts >= length) {
-                length = 1;
-                limbs[0] = 0;
+    /// @return true if sub-products of `len` limbs are worth a task of their own.
+    static bool parallel_split(size_t len) {
+        return pool_threads.load(std::memory_order_relaxed) > 1 && len >= pool_min_size.load(std::memory_order_relaxed);
+    }
+
+    void parallel_run(std::function<void()> *work, size_t count) {
+        std::vector<pool_task> tasks(count - 1);
+        for (size_t i = 1; i < count; ++i) {
+            tasks[i - 1].work = std::move(work[i]);
+            shared_pool().submit(&tasks[i - 1]);
+        }
+
+        work[0]();
+
+        // the last queued tasks are the least likely to be picked up already.
+        for (size_t i = tasks.size(); i--;) {
+            if (shared_pool().take(&tasks[i])) {
+                tasks[i].work();
             } else {
-                size_t bit_shifts = bits % BASE_BITS;
-                size_t new_length = length - limb_shifts;
+                shared_pool().wait(&tasks[i]);
+            }
+        }
+    }
 
-                // initial limb shift
-                limbs[0] = limbs[limb_shifts] >> bit_shifts;
+    void set_threads(size_t threads) {
+        threads = std::max(threads, (size_t) 1);
+        shared_pool().resize(threads);
+        pool_threads = threads;
+    }
 
-                // looped shifts
-                for (size_t i = 1; i < new_length; ++i) {
-                    cast_t temp_shift = limbs[i + limb_shifts];
-                    temp_shift = (temp_shift << BASE_BITS) >> bit_shifts;
-                    limbs[i - 1] |= temp_shift;
-                    limbs[i] = temp_shift >> BASE_BITS;
-                }
+    size_t get_threads() noexcept {
+        return pool_threads;
+    }
 
-                length = new_length;
-                length -= !limbs[length - 1] && length != 1;
+    void set_parallel_size(size_t limbs) {
+        pool_min_size = std::max(limbs, (size_t) 1);
+    }
+
+    size_t get_parallel_size() noexcept {
+        return pool_min_size;
+    }
+
+    // Multiplication Kernels
+
+    void integer::mul_limbs(
+        limb_t *out, size_t out_len, size_t out_index, const limb_t *num1, size_t num1_len, size_t num1_index,
+        const limb_t *num2, size_t num2_len, size_t num2_index
+    ) {
+        size_t min_len = std::min(num1_len, num2_len);
+        size_t max_len = std::max(num1_len, num2_len);
+
+        if (min_len < KARATSUBA_SIZE) {
+            mul_basecase(out, out_len, out_index, num1, num1_len, num1_index, num2, num2_len, num2_index);
+        } else if (min_len >= NTT_SIZE && ntt_supported(num1_len + num2_len)) {
+            mul_ntt(out, out_len, out_index, num1, num1_len, num1_index, num2, num2_len, num2_index);
+        } else if (max_len >= UNBALANCED_RATIO * min_len) {
+            mul_unbalanced(out, out_len, out_index, num1, num1_len, num1_index, num2, num2_len, num2_index);
+        } else if (min_len < TOOM3_SIZE || min_len <= 2 * ((max_len + 2) / 3)) {
+            // toom-3 needs all three parts of both operands to be non-empty.
+            mul_karatsuba(out, out_len, out_index, num1, num1_len, num1_index, num2, num2_len, num2_index);
+        } else {
+            mul_toom3(out, out_len, out_index, num1, num1_len, num1_index, num2, num2_len, num2_index);
+        }
+    }
+
+    void integer::mul_unbalanced(
+        limb_t *out, size_t, size_t out_index, const limb_t *num1, size_t num1_len, size_t num1_index,
+        const limb_t *num2, size_t num2_len, size_t num2_index
+    ) {
+        if (num1_len < num2_len) {
+            std::swap(num1, num2);
+            std::swap(num1_len, num2_len);
+            std::swap(num1_index, num2_index);
+        }
+
+        // the longer operand is sliced into evenly sized blocks that are about the length
+        // of the shorter operand, each block product is near balanced and is accumulated
+        // into the output.
+        size_t blocks = num1_len / num2_len;
+        size_t block_len = (num1_len + blocks - 1) / blocks;
+        size_t product_len = num1_len + num2_len;
+        limb_t *product = out + out_index;
+        limb_t *block_product = (limb_t *) std::malloc(LIMB_BYTES * (block_len + num2_len));
+        std::memset(product, 0x00, LIMB_BYTES * product_len);
+
+        for (size_t offset = 0; offset < num1_len; offset += block_len) {
+            size_t len = std::min(block_len, num1_len - offset);
+            size_t block_product_len = len + num2_len;
+
+            mul_limbs(
+                block_product, block_product_len, 0, num1, len, num1_index + offset, num2, num2_len, num2_index
+            );
+
+            limb_t carry = 0;
+            size_t i = 0;
+            for (; i < block_product_len; ++i) {
+                cast_t sum_index = (cast_t) product[offset + i] + block_product[i] + carry;
+                product[offset + i] = sum_index;
+                carry = sum_index >> BASE_BITS;
+            }
+
+            for (i += offset; carry && i < product_len; ++i) {
+                cast_t sum_index = (cast_t) product[i] + carry;
+                product[i] = sum_index;
+                carry = sum_index >> BASE_BITS;
             }
         }
-        return *this;
+
+        std::free(block_product);
     }
 
-    integer integer::operator<<(size_t bits) const noexcept {
-        integer shifted = *this;
-        return shifted <<= bits;
+    void integer::mul_basecase(
+        limb_t *out, size_t, size_t out_index, const limb_t *num1, size_t num1_len, size_t num1_index,
+        const limb_t *num2, size_t num2_len, size_t num2_index
+    ) {
+        host_kernels().mul_basecase(out + out_index, num1 + num1_index, num1_len, num2 + num2_index, num2_len);
     }
 
-    integer integer::operator>>(size_t bits) const noexcept {
-        integer shifted = *this;
-        return shifted >>= bits;
+    // Squaring Kernels
+
+    void integer::sqr_limbs(
+        limb_t *out, size_t out_len, size_t out_index, const limb_t *num, size_t len, size_t index
+    ) {
+        if (len < SQR_KARATSUBA_SIZE) {
+            sqr_basecase(out, out_len, out_index, num, len, index);
+        } else if (len >= NTT_SIZE && ntt_supported(len * 2)) {
+            mul_ntt(out, out_len, out_index, num, len, index, num, len, index);
+        } else if (len < TOOM3_SIZE) {
+            sqr_karatsuba(out, out_len, out_index, num, len, index);
+        } else {
+            mul_toom3(out, out_len, out_index, num, len, index, num, len, index);
+        }
     }
 
-    void integer::printBin_spaced_out() const {
-        for (size_t i = 0; i < length; ++i) {
-            std::cout << std::bitset<BASE_BITS>(limbs[length - 1 - i]) << " ";
+    void integer::sqr_basecase(
+        limb_t *out, size_t, size_t out_index, const limb_t *num, size_t len, size_t index
+    ) {
+        const limb_t *a = num + index;
+        limb_t *product = out + out_index;
+
+        // cross products a[i] * a[j] where i < j, each row ends on a limb that is not yet written.
+        std::memset(product, 0x00, len * LIMB_BYTES);
+        for (size_t i = 0; i < len; ++i) {
+            product[i + len] = addmul_1(product + i * 2 + 1, a + i + 1, len - i - 1, a[i]);
+        }
+
+        // double the cross products.
+        limb_t shift_carry = 0;
+        for (size_t i = 0; i < len * 2; ++i) {
+            limb_t next_carry = product[i] >> BASE_BITS_MINUS1;
+            product[i] = (product[i] << 1) | shift_carry;
+            shift_carry = next_carry;
+        }
+
+        // add the diagonal squares a[i] * a[i].
+        limb_t carry = 0;
+        for (size_t i = 0; i < len; ++i) {
+            cast_t diagonal = (cast_t) a[i] * a[i];
+            cast_t sum_index = (cast_t) product[2 * i] + (limb_t) diagonal + carry;
+            product[2 * i] = sum_index;
+            sum_index =
+                (cast_t) product[2 * i + 1] + (limb_t) (diagonal >> BASE_BITS) + (limb_t) (sum_index >> BASE_BITS);
+            product[2 * i + 1] = sum_index;
+            carry = sum_index >> BASE_BITS;
         }
-        std::cout << "\n";
     }
 
-    std::string integer::to_base10_string() const {
-        std::string Base10;
-        integer quotient = *this, remainder = 0;
-        Base10.reserve(quotient.length);
-        if (quotient) {
-            while (quotient) {
-                div_mod(quotient, remainder, quotient, __INTEGER_TEN);
-                Base10.push_back('0' + remainder.limbs[0]);
+    /// propagates `carry` through the `n` limbs of `out`, @return the carry out of the last limb.
+    static limb_t add_1(limb_t *out, size_t n, limb_t carry) {
+        for (size_t i = 0; carry && i < n; ++i) {
+            cast_t sum_index = (cast_t) out[i] + carry;
+            out[i] = sum_index;
+            carry = sum_index >> BASE_BITS;
+        }
+        return carry;
+    }
+
+    /// propagates `borrow` through the `n` limbs of `out`, @return the borrow out of the last limb.
+    static limb_t sub_1(limb_t *out, size_t n, limb_t borrow) {
+        for (size_t i = 0; borrow && i < n; ++i) {
+            cast_t dif_index = (cast_t) out[i] - borrow;
+            out[i] = dif_index;
+            borrow = (dif_index >> BASE_BITS) & 0x01;
+        }
+        return borrow;
+    }
+
+    /// writes `|l - r|` into the `l_len` limbs of `out` where `r_len <= l_len`, @return 1 if `l < r`.
+    static limb_t abs_sub(limb_t *out, const limb_t *l, size_t l_len, const limb_t *r, size_t r_len) {
+        size_t i = l_len;
+        while (i > r_len && !l[i - 1]) {
+            --i;
+        }
+
+        bool less = false;
+        if (i == r_len) {
+            while (i && l[i - 1] == r[i - 1]) {
+                --i;
             }
+            less = i && l[i - 1] < r[i - 1];
+        }
 
-            std::reverse(Base10.begin(), Base10.end());
+        if (less) {
+            integer::sub_n(out, r, l, r_len);
+            std::memset(out + r_len, 0x00, (l_len - r_len) * LIMB_BYTES);
         } else {
-            Base10 = "0";
+            limb_t carry = integer::sub_n(out, l, r, r_len);
+            for (i = r_len; i < l_len; ++i) {
+                cast_t dif_index = (cast_t) l[i] - carry;
+                out[i] = dif_index;
+                carry = (dif_index >> BASE_BITS) & 0x01;
+            }
+        }
+
+        return less;
+    }
+
+    /// upper bound of the scratch limbs used by a karatsuba recursion on operands of at most `len` limbs.
+    static size_t karatsuba_scratch_len(size_t len, size_t threshold) {
+        size_t scratch_len = 0;
+        while (len >= threshold) {
+            size_t half = len - (len / 2);
+            scratch_len += half * 4;
+            len = half;
+        }
+        return scratch_len;
+    }
+
+    /// karatsuba on raw limb ranges, the `a_len + b_len` limbs of `out` are fully overwritten
+    /// and every temporary lives in `scratch`.
+    static void karatsuba_limbs(
+        limb_t *out, const limb_t *a, size_t a_len, const limb_t *b, size_t b_len, limb_t *scratch
+    ) {
+        if (a_len < b_len) {
+            std::swap(a, b);
+            std::swap(a_len, b_len);
+        }
+
+        if (b_len < KARATSUBA_SIZE) {
+            integer::mul_basecase(out, a_len + b_len, 0, a, a_len, 0, b, b_len, 0);
+            return;
+        }
+
+        // a = a1 * B^half + a0
+        size_t half = a_len - (a_len / 2);
+        size_t a1_len = a_len - half;
+
+        // the shorter operand has no upper part : a * b = a0 * b + a1 * b * B^half
+        if (b_len <= half) {
+            limb_t *z = scratch;
+            size_t z_len = a1_len + b_len;
+
+            if (parallel_split(b_len)) {
+                limb_t *task_scratch = (limb_t *) std::malloc(LIMB_BYTES * karatsuba_scratch_len(half, KARATSUBA_SIZE));
+                std::function<void()> work[2] = {
+                    [=] { karatsuba_limbs(out, a, half, b, b_len, task_scratch); },
+                    [=] { karatsuba_limbs(z, a + half, a1_len, b, b_len, scratch + z_len); }
+                };
+                parallel_run(work, 2);
+                std::free(task_scratch);
+            } else {
+                karatsuba_limbs(out, a, half, b, b_len, scratch);
+                karatsuba_limbs(z, a + half, a1_len, b, b_len, scratch + z_len);
+            }
+
+            limb_t carry = integer::add_n(out + half, out + half, z, b_len);
+            std::memcpy(out + half + b_len, z + b_len, a1_len * LIMB_BYTES);
+            add_1(out + half + b_len, a1_len, carry);
+            return;
+        }
+
+        // b = b1 * B^half + b0
+        size_t b1_len = b_len - half;
+        size_t z1_len = a1_len + b1_len;
+
+        // z0 = a0 * b0 and z1 = a1 * b1 land in their final place.
+        // z2 = |a0 - a1| * |b0 - b1|, the differences never grow past `half` limbs.
+        limb_t *z0 = out, *z1 = out + half * 2;
+        limb_t *a_dif = scratch, *b_dif = scratch + half, *z2 = scratch + half * 2;
+        limb_t negative = abs_sub(a_dif, a, half, a + half, a1_len) ^ abs_sub(b_dif, b, half, b + half, b1_len);
+
+        if (parallel_split(b_len)) {
+            size_t task_scratch_len = karatsuba_scratch_len(half, KARATSUBA_SIZE);
+            limb_t *task_scratch = (limb_t *) std::malloc(LIMB_BYTES * task_scratch_len * 2);
+            std::function<void()> work[3] = {
+                [=] { karatsuba_limbs(z2, a_dif, half, b_dif, half, scratch + half * 4); },
+                [=] { karatsuba_limbs(z0, a, half, b, half, task_scratch); },
+                [=] { karatsuba_limbs(z1, a + half, a1_len, b + half, b1_len, task_scratch + task_scratch_len); }
+            };
+            parallel_run(work, 3);
+            std::free(task_scratch);
+        } else {
+            karatsuba_limbs(z0, a, half, b, half, scratch + half * 4);
+            karatsuba_limbs(z1, a + half, a1_len, b + half, b1_len, scratch + half * 4);
+            karatsuba_limbs(z2, a_dif, half, b_dif, half, scratch + half * 4);
+        }
+
+        // z3 = z0 + z1 - (a0 - a1) * (b0 - b1), the top limb of z3 is `carry`.
+        limb_t carry;
+        if (negative) {
+            carry = integer::add_n(z2, z2, z0, half * 2);
+        } else {
+            carry = 0 - integer::sub_n(z2, z0, z2, half * 2);
+        }
+        carry += add_1(z2 + z1_len, half * 2 - z1_len, integer::add_n(z2, z2, z1, z1_len));
+
+        // z4 = z1 * B^2half + z3 * B^half + z0
+        carry += integer::add_n(out + half, out + half, z2, half * 2);
+        add_1(out + half * 3, a_len + b_len - half * 3, carry);
+    }
+
+    /// karatsuba squaring on a raw limb range, the `2 * len` limbs of `out` are fully overwritten
+    /// and every temporary lives in `scratch`.
+    static void karatsuba_sqr_limbs(limb_t *out, const limb_t *a, size_t len, limb_t *scratch) {
+        if (len < SQR_KARATSUBA_SIZE) {
+            integer::sqr_basecase(out, len * 2, 0, a, len, 0);
+            return;
+        }
+
+        // a = a1 * B^half + a0 : a^2 = a1^2 * B^2half + (a0^2 + a1^2 - (a0 - a1)^2) * B^half + a0^2
+        size_t half = len - (len / 2);
+        size_t a1_len = len - half;
+        size_t z1_len = a1_len * 2;
+
+        limb_t *z0 = out, *z1 = out + half * 2;
+        limb_t *a_dif = scratch, *z2 = scratch + half;
+        abs_sub(a_dif, a, half, a + half, a1_len);
+
+        if (parallel_split(len)) {
+            size_t task_scratch_len = karatsuba_scratch_len(half, SQR_KARATSUBA_SIZE);
+            limb_t *task_scratch = (limb_t *) std::malloc(LIMB_BYTES * task_scratch_len * 2);
+            std::function<void()> work[3] = {
+                [=] { karatsuba_sqr_limbs(z2, a_dif, half, scratch + half * 3); },
+                [=] { karatsuba_sqr_limbs(z0, a, half, task_scratch); },
+                [=] { karatsuba_sqr_limbs(z1, a + half, a1_len, task_scratch + task_scratch_len); }
+            };
+            parallel_run(work, 3);
+            std::free(task_scratch);
+        } else {
+            karatsuba_sqr_limbs(z0, a, half, scratch + half * 3);
+            karatsuba_sqr_limbs(z1, a + half, a1_len, scratch + half * 3);
+            karatsuba_sqr_limbs(z2, a_dif, half, scratch + half * 3);
+        }
+
+        limb_t carry = 0 - integer::sub_n(z2, z0, z2, half * 2);
+        carry += add_1(z2 + z1_len, half * 2 - z1_len, integer::add_n(z2, z2, z1, z1_len));
+
+        carry += integer::add_n(out + half, out + half, z2, half * 2);
+        add_1(out + half * 3, len * 2 - half * 3, carry);
+    }
+
+    void integer::mul_karatsuba(
+        limb_t *out, size_t out_len, size_t out_index, const limb_t *num1, size_t num1_len, size_t num1_index,
+        const limb_t *num2, size_t num2_len, size_t num2_index
+    ) {
+        if (num2_len < KARATSUBA_SIZE || num1_len < KARATSUBA_SIZE) {
+            mul_basecase(out, out_len, out_index, num1, num1_len, num1_index, num2, num2_len, num2_index);
+            return;
+        }
+
+        // the whole recursion shares one scratch buffer.
+        size_t scratch_len = karatsuba_scratch_len(std::max(num1_len, num2_len), KARATSUBA_SIZE);
+        limb_t *scratch = (limb_t *) std::malloc(LIMB_BYTES * scratch_len);
+        karatsuba_limbs(out + out_index, num1 + num1_index, num1_len, num2 + num2_index, num2_len, scratch);
+        std::free(scratch);
+    }
+
+    void integer::sqr_karatsuba(
+        limb_t *out, size_t out_len, size_t out_index, const limb_t *num, size_t len, size_t index
+    ) {
+        if (len < SQR_KARATSUBA_SIZE) {
+            sqr_basecase(out, out_len, out_index, num, len, index);
+            return;
+        }
+
+        // the whole recursion shares one scratch buffer.
+        limb_t *scratch = (limb_t *) std::malloc(LIMB_BYTES * karatsuba_scratch_len(len, SQR_KARATSUBA_SIZE));
+        karatsuba_sqr_limbs(out + out_index, num + index, len, scratch);
+        std::free(scratch);
+    }
+
+    /// copies a limb range into a new normalized integer, an empty range is zero.
+    static integer toom_slice(const limb_t *src, size_t len) {
+        if (!len) {
+            return __INTEGER_ZERO;
+        }
+
+        integer slice(len + LIMB_GROWTH, len);
+        std::memcpy(slice.limbs, src, len * LIMB_BYTES);
+        slice.remove_leading_zeros();
+        return slice;
+    }
+
+    /// signed accumulation `(a, a_sign) += (b, b_sign)` on integer magnitudes.
+    static void toom_add(integer &a, limb_t &a_sign, const integer &b, limb_t b_sign) {
+        if (a_sign == b_sign) {
+            a += b;
+        } else if (a >= b) {
+            a -= b;
+        } else {
+            a = b - a;
+            a_sign = b_sign;
+        }
+
+        if (!a) {
+            a_sign = 0;
+        }
+    }
+
+    /// adds `src` into `out` starting at limb `offset`, the carry stops at `out_len`.
+    static void toom_add_at(limb_t *out, size_t out_len, size_t offset, const integer &src) {
+        limb_t carry = 0;
+        size_t i = 0;
+        for (; i < src.length; ++i) {
+            cast_t sum_index = (cast_t) out[offset + i] + src.limbs[i] + carry;
+            out[offset + i] = sum_index;
+            carry = sum_index >> BASE_BITS;
+        }
+
+        for (i += offset; carry && i < out_len; ++i) {
+            cast_t sum_index = (cast_t) out[i] + carry;
+            out[i] = sum_index;
+            carry = sum_index >> BASE_BITS;
+        }
+    }
+
+    /// an operand of toom-3 evaluated at the points 0, 1, -1, -2 and infinity.
+    struct toom_points {
+        integer v0, v1, vm1, vm2, vinf;
+        limb_t vm1_sign = 0, vm2_sign = 0;
+    };
+
+    /// splits `x` into 3 parts of `k` limbs and evaluates it at the toom-3 points.
+    static void toom_evaluate(toom_points &points, const limb_t *x, size_t x_len, size_t k) {
+        integer x0 = toom_slice(x, k), x1 = toom_slice(x + k, k);
+        points.vinf = toom_slice(x + 2 * k, x_len - 2 * k);
+
+        integer xt = x0 + points.vinf;
+        points.v1 = xt + x1;
+
+        points.vm1 = std::move(xt);
+        points.vm1_sign = 0;
+        toom_add(points.vm1, points.vm1_sign, x1, 1);
+
+        // x(-2) = (x(-1) + x2) * 2 - x0
+        points.vm2 = points.vm1;
+        points.vm2_sign = points.vm1_sign;
+        toom_add(points.vm2, points.vm2_sign, points.vinf, 0);
+        points.vm2 <<= 1;
+        toom_add(points.vm2, points.vm2_sign, x0, 1);
+
+        points.v0 = std::move(x0);
+    }
+
+    /// `q = u / d` for an odd `d` that divides `u` exactly, `inverse` is `binvert_limb(d[0])`. The
+    /// `q_len` quotient limbs are produced from the low end, `u` is overwritten and `q` may be `u`.
+    void divexact_hensel(limb_t *q, limb_t *u, size_t q_len, const limb_t *d, size_t d_len, limb_t inverse);
+
+    void integer::mul_toom3(
+        limb_t *out, size_t, size_t out_index, const limb_t *num1, size_t num1_len, size_t num1_index,
+        const limb_t *num2, size_t num2_len, size_t num2_index
+    ) {
+        // split both operands into 3 parts of `k` limbs : x = x2*B^2k + x1*B^k + x0
+        size_t k = (std::max(num1_len, num2_len) + 2) / 3;
+        const limb_t *a = num1 + num1_index;
+        const limb_t *b = num2 + num2_index;
+
+        // a square only evaluates one operand, the point-wise products then alias and are squared.
+        toom_points p, q_values;
+        toom_evaluate(p, a, num1_len, k);
+        bool square = a == b && num1_len == num2_len;
+        if (!square) {
+            toom_evaluate(q_values, b, num2_len, k);
+        }
+        const toom_points &q = square ? p : q_values;
+
+        // point-wise products, these recurse back to the multiplication dispatch.
+        integer r0, r1, rm1, rm2, rinf;
+        if (parallel_split(k)) {
+            std::function<void()> work[5] = {
+                [&] { r0 = p.v0 * q.v0; }, [&] { r1 = p.v1 * q.v1; }, [&] { rm1 = p.vm1 * q.vm1; },
+                [&] { rm2 = p.vm2 * q.vm2; }, [&] { rinf = p.vinf * q.vinf; }
+            };
+            parallel_run(work, 5);
+        } else {
+            r0 = p.v0 * q.v0;
+            r1 = p.v1 * q.v1;
+            rm1 = p.vm1 * q.vm1;
+            rm2 = p.vm2 * q.vm2;
+            rinf = p.vinf * q.vinf;
+        }
+        limb_t rm1_sign = (p.vm1_sign ^ q.vm1_sign) & !!rm1;
+        limb_t rm2_sign = (p.vm2_sign ^ q.vm2_sign) & !!rm2;
+
+        // interpolation (Bodrato's sequence).
+        // r3 = (r(-2) - r(1)) / 3
+        integer r3 = std::move(rm2);
+        limb_t r3_sign = rm2_sign;
+        toom_add(r3, r3_sign, r1, 1);
+        const limb_t three = 3;
+        divexact_hensel(r3.limbs, r3.limbs, r3.length, &three, 1, binvert_limb(three));
+        r3.remove_leading_zeros();
+
+        // r1 = (r(1) - r(-1)) / 2
+        limb_t r1_sign = 0;
+        toom_add(r1, r1_sign, rm1, rm1_sign ^ 1u);
+        r1 >>= 1;
+
+        // r2 = r(-1) - r(0)
+        integer r2 = std::move(rm1);
+        limb_t r2_sign = rm1_sign;
+        toom_add(r2, r2_sign, r0, 1);
+
+        // r3 = (r2 - r3) / 2 + 2 * r(inf)
+        r3_sign ^= !!r3;
+        toom_add(r3, r3_sign, r2, r2_sign);
+        r3 >>= 1;
+        toom_add(r3, r3_sign, rinf << 1, 0);
+
+        // r2 = r2 + r1 - r(inf)
+        toom_add(r2, r2_sign, r1, r1_sign);
+        toom_add(r2, r2_sign, rinf, 1);
+
+        // r1 = r1 - r3
+        toom_add(r1, r1_sign, r3, r3_sign ^ 1u);
+
+        // recomposition, all of the remaining coefficients are non-negative.
+        limb_t *product = out + out_index;
+        size_t product_len = num1_len + num2_len;
+        std::memset(product, 0x00, product_len * LIMB_BYTES);
+        toom_add_at(product, product_len, 0, r0);
+        toom_add_at(product, product_len, k, r1);
+        toom_add_at(product, product_len, 2 * k, r2);
+        toom_add_at(product, product_len, 3 * k, r3);
+        toom_add_at(product, product_len, 4 * k, rinf);
+    }
+
+#ifndef _BASE2_16
+    /// a prime for the number-theoretic transform : `p = c * 2^max_log2 + 1`, with the primitive root `g`.
+    struct ntt_prime {
+        limb_t p;
+        limb_t g;
+        size_t max_log2;
+    };
+
+    #ifdef _BASE2_64
+    static const ntt_prime NTT_PRIMES[3] = {
+        {(limb_t) 2287828610704211969ull, 3, 50},
+        {(limb_t) 2276569611635785729ull, 11, 50},
+        {(limb_t) 2254051613498933249ull, 3, 50}
+    };
+    #else
+    static const ntt_prime NTT_PRIMES[3] = {
+        {(limb_t) 2013265921u, 31, 27},
+        {(limb_t) 1811939329u, 13, 26},
+        {(limb_t) 469762049u, 3, 26}
+    };
+    #endif
+
+    static const size_t NTT_MAX_LOG2 = 26 + 24 * (BASE_BITS == 64);
+
+    /// montgomery arithmetic modulo a `ntt_prime`, `R = 2^BASE_BITS`.
+    struct ntt_field {
+        limb_t p;
+        limb_t p_inv; // -p^-1 mod R
+        limb_t one;   // R mod p
+        limb_t r2;    // R^2 mod p
+
+        ntt_field(limb_t p) : p(p) {
+            limb_t inv = p;
+            for (size_t i = 0; i < 6; ++i) {
+                inv *= 2 - p * inv;
+            }
+            p_inv = 0 - inv;
+            one = (((cast_t) 1) << BASE_BITS) % p;
+            r2 = ((cast_t) one * one) % p;
+        }
+
+        /// @return `a * b * R^-1 mod p`.
+        limb_t mul(limb_t a, limb_t b) const {
+            cast_t t = (cast_t) a * b;
+            limb_t m = (limb_t) t * p_inv;
+            limb_t r = (t + (cast_t) m * p) >> BASE_BITS;
+            return r >= p ? r - p : r;
+        }
+
+        limb_t add(limb_t a, limb_t b) const {
+            limb_t r = a + b;
+            return r >= p ? r - p : r;
+        }
+
+        limb_t sub(limb_t a, limb_t b) const {
+            return a >= b ? a - b : a + p - b;
+        }
+
+        /// @return `a mod p`, for any limb value.
+        limb_t reduce(limb_t a) const {
+            return mul(a, one);
+        }
+
+        /// @return `a` in montgomery form, `a * R mod p`.
+        limb_t to_montgomery(limb_t a) const {
+            return mul(reduce(a), r2);
+        }
+
+        /// @return `base^exp mod p`, in montgomery form.
+        limb_t pow(limb_t base, limb_t exp) const {
+            limb_t result = one, b = to_montgomery(base);
+            while (exp) {
+                if (exp & 1) {
+                    result = mul(result, b);
+                }
+                b = mul(b, b);
+                exp >>= 1;
+            }
+            return result;
+        }
+    };
+
+    /// in-place decimation in time transform, `roots[h + j]` holds `w_2h^j` in montgomery form.
+    static void ntt_transform(limb_t *x, size_t n, const limb_t *roots, const ntt_field &field) {
+        for (size_t i = 1, j = 0; i < n; ++i) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(x[i], x[j]);
+            }
+        }
+
+        for (size_t h = 1; h < n; h <<= 1) {
+            for (size_t i = 0; i < n; i += 2 * h) {
+                for (size_t j = 0; j < h; ++j) {
+                    limb_t u = x[i + j];
+                    limb_t v = field.mul(x[i + j + h], roots[h + j]);
+                    x[i + j] = field.add(u, v);
+                    x[i + j + h] = field.sub(u, v);
+                }
+            }
+        }
+    }
+
+    /// cyclic convolution of `l` and `r` modulo `prime`, the `n` coefficients are written to `conv`.
+    static void ntt_convolution(
+        limb_t *conv, limb_t *scratch, limb_t *roots, size_t n, const limb_t *l, size_t l_len, const limb_t *r,
+        size_t r_len, const ntt_prime &prime
+    ) {
+        ntt_field field(prime.p);
+
+        // roots of unity table for every level of the transform.
+        limb_t w = field.pow(prime.g, (prime.p - 1) / n);
+        roots[n / 2] = field.one;
+        for (size_t j = 1; j < n / 2; ++j) {
+            roots[n / 2 + j] = field.mul(roots[n / 2 + j - 1], w);
+        }
+        for (size_t h = n / 4; h; h >>= 1) {
+            for (size_t j = 0; j < h; ++j) {
+                roots[h + j] = roots[2 * h + 2 * j];
+            }
+        }
+
+        for (size_t i = 0; i < l_len; ++i) {
+            conv[i] = field.reduce(l[i]);
+        }
+        std::memset(conv + l_len, 0x00, (n - l_len) * LIMB_BYTES);
+
+        ntt_transform(conv, n, roots, field);
+
+        // point-wise product leaves a factor of R^-1, a square only needs one forward transform.
+        if (l == r && l_len == r_len) {
+            for (size_t i = 0; i < n; ++i) {
+                conv[i] = field.mul(conv[i], conv[i]);
+            }
+        } else {
+            for (size_t i = 0; i < r_len; ++i) {
+                scratch[i] = field.reduce(r[i]);
+            }
+            std::memset(scratch + r_len, 0x00, (n - r_len) * LIMB_BYTES);
+            ntt_transform(scratch, n, roots, field);
+
+            for (size_t i = 0; i < n; ++i) {
+                conv[i] = field.mul(conv[i], scratch[i]);
+            }
+        }
+
+        // inverse transform : forward transform then reverse the coefficients 1 to n-1.
+        ntt_transform(conv, n, roots, field);
+        std::reverse(conv + 1, conv + n);
+
+        // scale by n^-1 and cancel the R^-1 left by the point-wise product.
+        limb_t scale = field.mul(field.pow(n, prime.p - 2), field.r2);
+        for (size_t i = 0; i < n; ++i) {
+            conv[i] = field.mul(conv[i], scale);
+        }
+    }
+#endif
+
+    void integer::mul_ntt(
+        limb_t *out, size_t, size_t out_index, const limb_t *num1, size_t num1_len, size_t num1_index,
+        const limb_t *num2, size_t num2_len, size_t num2_index
+    ) {
+#ifdef _BASE2_16
+        mul_toom3(out, 0, out_index, num1, num1_len, num1_index, num2, num2_len, num2_index);
+#else
+        size_t product_len = num1_len + num2_len;
+        size_t n = 1;
+        while (n < product_len - 1) {
+            n <<= 1;
+        }
+        n = std::max(n, (size_t) 2);
+
+        // the convolutions share one scratch and roots table unless they run in parallel.
+        bool parallel = parallel_split(std::min(num1_len, num2_len));
+        size_t tables = parallel ? 3 : 1;
+        limb_t *buffer = (limb_t *) std::malloc(LIMB_BYTES * n * (3 + tables * 2));
+        limb_t *c1 = buffer, *c2 = buffer + n, *c3 = buffer + 2 * n;
+        limb_t *scratch = buffer + 3 * n, *roots = scratch + tables * n;
+
+        const limb_t *a = num1 + num1_index, *b = num2 + num2_index;
+        if (parallel) {
+            std::function<void()> work[3] = {
+                [=] { ntt_convolution(c1, scratch, roots, n, a, num1_len, b, num2_len, NTT_PRIMES[0]); },
+                [=] { ntt_convolution(c2, scratch + n, roots + n, n, a, num1_len, b, num2_len, NTT_PRIMES[1]); },
+                [=] { ntt_convolution(c3, scratch + 2 * n, roots + 2 * n, n, a, num1_len, b, num2_len, NTT_PRIMES[2]); }
+            };
+            parallel_run(work, 3);
+        } else {
+            ntt_convolution(c1, scratch, roots, n, a, num1_len, b, num2_len, NTT_PRIMES[0]);
+            ntt_convolution(c2, scratch, roots, n, a, num1_len, b, num2_len, NTT_PRIMES[1]);
+            ntt_convolution(c3, scratch, roots, n, a, num1_len, b, num2_len, NTT_PRIMES[2]);
+        }
+
+        // chinese remainder theorem (Garner) : c = x1 + p1 * x2 + p1 * p2 * x3.
+        limb_t p1 = NTT_PRIMES[0].p, p2 = NTT_PRIMES[1].p;
+        ntt_field f2(p2), f3(NTT_PRIMES[2].p);
+        limb_t inv_p1_p2 = f2.pow(p1, p2 - 2);
+        limb_t inv_p1_p3 = f3.pow(p1, f3.p - 2);
+        limb_t inv_p2_p3 = f3.pow(p2, f3.p - 2);
+
+        cast_t p1p2 = (cast_t) p1 * p2;
+        limb_t p1p2_lo = p1p2, p1p2_hi = p1p2 >> BASE_BITS;
+
+        // each coefficient takes 3 limbs, they are carried through a 4 limb accumulator.
+        limb_t *product = out + out_index;
+        limb_t acc[4] = {0, 0, 0, 0};
+        for (size_t i = 0; i < product_len; ++i) {
+            limb_t v[3] = {0, 0, 0};
+            if (i < product_len - 1) {
+                limb_t x1 = c1[i];
+                limb_t x2 = f2.mul(f2.sub(c2[i], f2.reduce(x1)), inv_p1_p2);
+                limb_t x3 = f3.mul(f3.sub(c3[i], f3.reduce(x1)), inv_p1_p3);
+                x3 = f3.mul(f3.sub(x3, f3.reduce(x2)), inv_p2_p3);
+
+                cast_t t = (cast_t) p1 * x2 + x1;
+                cast_t u = (cast_t) p1p2_lo * x3 + (limb_t) t;
+                v[0] = u;
+                u = (cast_t) p1p2_hi * x3 + (limb_t) (t >> BASE_BITS) + (limb_t) (u >> BASE_BITS);
+                v[1] = u;
+                v[2] = u >> BASE_BITS;
+            }
+
+            limb_t carry = 0;
+            for (size_t j = 0; j < 3; ++j) {
+                cast_t sum_index = (cast_t) acc[j] + v[j] + carry;
+                acc[j] = sum_index;
+                carry = sum_index >> BASE_BITS;
+            }
+            acc[3] += carry;
+
+            product[i] = acc[0];
+            acc[0] = acc[1];
+            acc[1] = acc[2];
+            acc[2] = acc[3];
+            acc[3] = 0;
+        }
+
+        std::free(buffer);
+#endif
+    }
+
+    bool integer::ntt_supported(size_t product_len) noexcept {
+#ifdef _BASE2_16
+        (void) product_len;
+        return false;
+#else
+        return product_len - 1 <= ((size_t) 1 << NTT_MAX_LOG2);
+#endif
+    }
+
+    // Short Products
+    // - the partial products `a[i] * b[j]` that cannot reach the wanted limbs are skipped, above
+    //   `MUL_LOW_SIZE` and `MUL_HIGH_SIZE` one full block product from `mul_limbs` is taken and the
+    //   two strips beside it recurse, as in Mulders' short product.
+
+    /// adds the `src_len` limbs of `src` into `out`, the carry stops at `out_len`.
+    static void short_add(limb_t *out, size_t out_len, const limb_t *src, size_t src_len) {
+        add_1(out + src_len, out_len - src_len, integer::add_n(out, out, src, src_len));
+    }
+
+    /// writes the low `n` limbs of `a * b` into `out`, where `a_len <= n` and `b_len <= n`.
+    void mullo_limbs(limb_t *out, const limb_t *a, size_t a_len, const limb_t *b, size_t b_len, size_t n) {
+        if (a_len + b_len <= n) {
+            integer::mul_limbs(out, n, 0, a, a_len, 0, b, b_len, 0);
+            std::memset(out + a_len + b_len, 0x00, (n - a_len - b_len) * LIMB_BYTES);
+            return;
+        }
+
+        if (std::min(a_len, b_len) < MUL_LOW_SIZE) {
+            // schoolbook rows cut at limb `n`, a carry past `n` is dropped.
+            std::memset(out, 0x00, n * LIMB_BYTES);
+            for (size_t i = 0; i < a_len; ++i) {
+                size_t row_len = std::min(b_len, n - i);
+                limb_t carry = integer::addmul_1(out + i, b, row_len, a[i]);
+                if (i + row_len < n) {
+                    out[i + row_len] = carry;
+                }
+            }
+            return;
+        }
+
+        // a = a1 * B^s_a + a0 and b = b1 * B^s_b + b0 where s_a + s_b >= n, a1 * b1 never reaches
+        // the low `n` limbs : a * b = a0 * b0 + a1 * b0 * B^s_a + a0 * b1 * B^s_b (mod B^n)
+        size_t block = n - (n * 3) / 10;
+        size_t s_a = std::min(a_len, block);
+        size_t s_b = std::min(b_len, std::max(block, n - s_a));
+        s_a = std::max(s_a, n - s_b);
+
+        limb_t *product = (limb_t *) std::malloc(LIMB_BYTES * (s_a + s_b));
+        integer::mul_limbs(product, s_a + s_b, 0, a, s_a, 0, b, s_b, 0);
+        std::memcpy(out, product, n * LIMB_BYTES);
+
+        // the strips fit in the block product buffer since `n - s_a <= s_b` and `n - s_b <= s_a`.
+        if (s_a < a_len) {
+            size_t strip_len = n - s_a;
+            mullo_limbs(product, a + s_a, std::min(a_len - s_a, strip_len), b, strip_len, strip_len);
+            short_add(out + s_a, strip_len, product, strip_len);
+        }
+
+        if (s_b < b_len) {
+            size_t strip_len = n - s_b;
+            mullo_limbs(product, a, strip_len, b + s_b, std::min(b_len - s_b, strip_len), strip_len);
+            short_add(out + s_b, strip_len, product, strip_len);
+        }
+
+        std::free(product);
+    }
+
+    /// writes the sum of the partial products `a[i] * b[j]` where `i + j >= c` into the `a_len + b_len`
+    /// limbs of `out`, some of the partial products below `c` may also be included.
+    void mulhi_limbs(limb_t *out, const limb_t *a, size_t a_len, const limb_t *b, size_t b_len, size_t c) {
+        size_t len = a_len + b_len;
+
+        if (!c) {
+            integer::mul_limbs(out, len, 0, a, a_len, 0, b, b_len, 0);
+            return;
+        }
+
+        if (c >= len - 1) {
+            std::memset(out, 0x00, len * LIMB_BYTES);
+            return;
+        }
+
+        // the low limbs of one operand that only pair below `c` with every limb of the other.
+        if (c >= a_len) {
+            size_t skip = c - (a_len - 1);
+            std::memset(out, 0x00, skip * LIMB_BYTES);
+            mulhi_limbs(out + skip, a, a_len, b + skip, b_len - skip, c - skip);
+            return;
+        }
+
+        if (c >= b_len) {
+            size_t skip = c - (b_len - 1);
+            std::memset(out, 0x00, skip * LIMB_BYTES);
+            mulhi_limbs(out + skip, a + skip, a_len - skip, b, b_len, c - skip);
+            return;
+        }
+
+        if (std::min(a_len, b_len) < MUL_HIGH_SIZE) {
+            // schoolbook rows that start at column `c`.
+            std::memset(out, 0x00, len * LIMB_BYTES);
+            for (size_t i = 0; i < a_len; ++i) {
+                size_t j = c > i ? c - i : 0;
+                out[i + b_len] = integer::addmul_1(out + i + j, b + j, b_len - j, a[i]);
+            }
+            return;
+        }
+
+        // a = a1 * B^s_a + a0 and b = b1 * B^s_b + b0 where s_a + s_b <= c + 1, a0 * b0 only holds
+        // partial products below `c` : a * b ~ a1 * b1 * B^(s_a + s_b) + a0 * b1 * B^s_b + a1 * b0 * B^s_a
+        size_t split = std::max((size_t) 1, ((c + 1) * 3) / 5);
+        size_t s_a;
+        if (a_len >= b_len) {
+            s_a = std::min(split, (split + a_len - b_len) / 2);
+        } else {
+            s_a = split > b_len - a_len ? (split - (b_len - a_len)) / 2 : 0;
+        }
+        size_t s_b = split - s_a;
+
+        // the block product a1 * b1 is kept near square.
+        std::memset(out, 0x00, split * LIMB_BYTES);
+        integer::mul_limbs(out, len, split, a, a_len - s_a, s_a, b, b_len - s_b, s_b);
+
+        limb_t *strip = (limb_t *) std::malloc(LIMB_BYTES * std::max(s_a + b_len - s_b, a_len - s_a + s_b));
+        if (s_a) {
+            mulhi_limbs(strip, a, s_a, b + s_b, b_len - s_b, c - s_b);
+            short_add(out + s_b, len - s_b, strip, s_a + b_len - s_b);
+        }
+
+        if (s_b) {
+            mulhi_limbs(strip, a + s_a, a_len - s_a, b, s_b, c - s_a);
+            short_add(out + s_a, len - s_a, strip, a_len - s_a + s_b);
+        }
+        std::free(strip);
+    }
+
+    integer mul_low(const integer &a, const integer &b, size_t n) {
+        if (!n || !a || !b) {
+            return __INTEGER_ZERO;
+        }
+
+        integer low(n + LIMB_GROWTH, n);
+        mullo_limbs(low.limbs, a.limbs, std::min(a.length, n), b.limbs, std::min(b.length, n), n);
+        low.remove_leading_zeros();
+        return low;
+    }
+
+    integer mul_high(const integer &a, const integer &b, size_t n) {
+        if (!a || !b || n >= a.length + b.length) {
+            return __INTEGER_ZERO;
+        }
+
+        // the skipped partial products sum below `min_len * B^(n - guard + 1)`, with
+        // `B^(guard - 2) >= 2 * min_len` they can only carry into limb `n` through a saturated limb `n - 1`.
+        size_t min_len = std::min(a.length, b.length), bits = 0;
+        for (size_t span = min_len * 2; span; span >>= 1) {
+            ++bits;
+        }
+        size_t guard = 2 + (bits + BASE_BITS_MINUS1) / BASE_BITS;
+
+        size_t len = a.length + b.length;
+        integer high(len + 1, len);
+        if (n <= guard) {
+            integer::mul_limbs(high.limbs, len, 0, a.limbs, a.length, 0, b.limbs, b.length, 0);
+        } else {
+            mulhi_limbs(high.limbs, a.limbs, a.length, b.limbs, b.length, n - guard);
+            if (high.limbs[n - 1] == BASE_MAX) {
+                integer::mul_limbs(high.limbs, len, 0, a.limbs, a.length, 0, b.limbs, b.length, 0);
+            }
+        }
+
+        std::memmove(high.limbs, high.limbs + n, (len - n) * LIMB_BYTES);
+        high.length = len - n;
+        high.remove_leading_zeros();
+        return high;
+    }
+
+    // Fused Multiply-Add
+    // - the rows `a * b[j]` are added into or subtracted from `acc` in place, only operands past
+    //   `KARATSUBA_SIZE` or an `acc` that shares its limbs with an operand go through a product buffer.
+
+    /// `acc += a * b` or `acc = |acc - a * b|`, @return true if the subtraction went below zero.
+    static bool fused_mul(integer &acc, const limb_t *a, size_t a_len, const limb_t *b, size_t b_len, bool subtract) {
+        if (a_len < b_len) {
+            std::swap(a, b);
+            std::swap(a_len, b_len);
+        }
+
+        // taken before `acc` grows, its limbs may move.
+        size_t len = a_len + b_len;
+        limb_t *product = NULL;
+        if (b_len >= KARATSUBA_SIZE || acc.limbs == a || acc.limbs == b) {
+            product = (limb_t *) std::malloc(len * LIMB_BYTES);
+            integer::mul_limbs(product, len, 0, a, a_len, 0, b, b_len, 0);
+        }
+
+        // one extra limb for the final carry of an addition.
+        size_t n = std::max(acc.length, len) + !subtract;
+        if (acc.capacity < n) {
+            acc.capacity = n + LIMB_GROWTH;
+            acc.limbs = (limb_t *) std::realloc(acc.limbs, acc.capacity * LIMB_BYTES);
+        }
+        std::memset(acc.limbs + acc.length, 0x00, (n - acc.length) * LIMB_BYTES);
+        acc.length = n;
+
+        limb_t *out = acc.limbs;
+        limb_t carry = 0;
+        if (product) {
+            if (subtract) {
+                carry = sub_1(out + len, n - len, integer::sub_n(out, out, product, len));
+            } else {
+                carry = add_1(out + len, n - len, integer::add_n(out, out, product, len));
+            }
+            std::free(product);
+        } else {
+            // the carry of a row is propagated right away so the next row starts from settled limbs,
+            // the borrows sum up to one exactly when `acc < a * b`.
+            for (size_t j = 0; j < b_len; ++j) {
+                limb_t *row = out + j;
+                if (subtract) {
+                    carry += sub_1(row + a_len, n - j - a_len, integer::submul_1(row, a, a_len, b[j]));
+                } else {
+                    carry += add_1(row + a_len, n - j - a_len, integer::addmul_1(row, a, a_len, b[j]));
+                }
+            }
+        }
+
+        // `acc - a * b + B^n` is turned into its magnitude by a two's complement negation.
+        if (subtract && carry) {
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = ~out[i];
+            }
+            add_1(out, n, 1);
+        }
+
+        acc.remove_leading_zeros();
+        return subtract && carry;
+    }
+
+    void addmul(integer &acc, const integer &a, const integer &b) {
+        if (a && b) {
+            fused_mul(acc, a.limbs, a.length, b.limbs, b.length, false);
+        }
+    }
+
+    bool submul(integer &acc, const integer &a, const integer &b) {
+        return a && b && fused_mul(acc, a.limbs, a.length, b.limbs, b.length, true);
+    }
+
+    void addmul_1(integer &acc, const integer &a, limb_t b) {
+        if (a && b) {
+            fused_mul(acc, a.limbs, a.length, &b, 1, false);
+        }
+    }
+
+    bool submul_1(integer &acc, const integer &a, limb_t b) {
+        return a && b && fused_mul(acc, a.limbs, a.length, &b, 1, true);
+    }
+
+
+    // Division
+    // - multi-limb divisors use Knuth's algorithm D, both operands are shifted until the top bit of
+    //   the divisor is set so every estimated quotient limb is at most two above the true one.
+    // - from `BURNIKEL_ZIEGLER_SIZE` limbs of divisor and quotient the Burnikel-Ziegler recursion
+    //   takes over, its 3n/2n step trades half of the schoolbook work for one `mul_limbs` product.
+    // - from `NEWTON_DIV_SIZE` limbs the quotient is the dividend times a newton reciprocal of the
+    //   divisor, corrected by a few subtractions.
+
+    /// `out = in << shift` over `n` limbs where `shift < BASE_BITS`, @return the bits shifted out.
+    static limb_t lshift_limbs(limb_t *out, const limb_t *in, size_t n, size_t shift) {
+        if (!shift) {
+            std::memmove(out, in, n * LIMB_BYTES);
+            return 0;
+        }
+
+        limb_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            limb_t limb = in[i];
+            out[i] = (limb_t) (limb << shift) | carry;
+            carry = limb >> (BASE_BITS - shift);
+        }
+        return carry;
+    }
+
+    /// `out = in >> shift` over `n` limbs where `shift < BASE_BITS`.
+    static void rshift_limbs(limb_t *out, const limb_t *in, size_t n, size_t shift) {
+        if (!shift) {
+            std::memmove(out, in, n * LIMB_BYTES);
+            return;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            limb_t high = i + 1 < n ? in[i + 1] : 0;
+            out[i] = (limb_t) (in[i] >> shift) | (limb_t) (high << (BASE_BITS - shift));
+        }
+    }
+
+    /// grows the capacity of `num` to at least `len` limbs, the limbs are not kept.
+    static void fit_limbs(integer &num, size_t len) {
+        if (num.capacity < len) {
+            std::free(num.limbs);
+            num.capacity = len + LIMB_GROWTH;
+            num.limbs = (limb_t *) std::malloc(num.capacity * LIMB_BYTES);
+        }
+    }
+
+    // Invariant Divisors
+    // - Möller-Granlund, for a limb `d` with its top bit set `v = floor((B^2 - 1) / d) - B` turns the
+    //   division of two limbs by `d` into two multiplications and at most two corrections, the
+    //   reciprocal of the top two divisor limbs does the same for the 3-by-2 step of algorithm D.
+
+    /// @return returns `floor((B^3 - 1) / <d1, d0>) - B` for a limb `d1` with its top bit set.
+    static limb_t reciprocal_3by2(limb_t d1, limb_t d0) {
+        limb_t v = integer::reciprocal_2by1(d1);
+        limb_t p = (limb_t) ((limb_t) ((cast_t) d1 * v) + d0);
+        if (p < d0) {
+            --v;
+            if (p >= d1) {
+                --v;
+                p = (limb_t) (p - d1);
+            }
+            p = (limb_t) (p - d1);
+        }
+
+        cast_t t = (cast_t) v * d0;
+        limb_t t1 = (limb_t) (t >> BASE_BITS), t0 = (limb_t) t;
+        p = (limb_t) (p + t1);
+        if (p < t1) {
+            --v;
+            if (p > d1 || (p == d1 && t0 >= d0)) {
+                --v;
+            }
+        }
+        return v;
+    }
+
+    /// `q = <u2, u1, u0> / <d1, d0>` for `<u2, u1> < <d1, d0>`, `v` is `reciprocal_3by2(d1, d0)`,
+    /// @return the two limbs remainder.
+    static cast_t div_3by2(limb_t &q, limb_t u2, limb_t u1, limb_t u0, limb_t d1, limb_t d0, limb_t v) {
+        cast_t p = (cast_t) v * u2 + (((cast_t) u2 << BASE_BITS) | u1), d = ((cast_t) d1 << BASE_BITS) | d0;
+        limb_t q1 = (limb_t) (p >> BASE_BITS), q0 = (limb_t) p;
+        limb_t r1 = (limb_t) (u1 - (limb_t) ((cast_t) q1 * d1));
+
+        // `cast_t` wraps modulo `B^2` like the two limbs it stands for.
+        cast_t r = ((((cast_t) r1 << BASE_BITS) | u0) - (cast_t) d0 * q1) - d;
+        ++q1;
+        if ((limb_t) (r >> BASE_BITS) >= q0) {
+            --q1;
+            r += d;
+        }
+        if (r >= d) {
+            ++q1;
+            r -= d;
+        }
+        q = q1;
+        return r;
+    }
+
+    /// Knuth's algorithm D, divides the `u_len` limbs of `u` by the `v_len >= 2` limbs of `v` whose
+    /// top bit is set, `inverse` is `reciprocal_3by2` of the top two limbs of `v`. The top `v_len` limbs
+    /// of `u` have to be less than `v`, the `u_len - v_len` quotient limbs go to `q` and the remainder
+    /// is left in the low `v_len` limbs of `u`.
+    static void divrem_knuth(limb_t *q, limb_t *u, size_t u_len, const limb_t *v, size_t v_len, limb_t inverse) {
+        limb_t d1 = v[v_len - 1], d0 = v[v_len - 2];
+
+        for (size_t j = u_len - v_len; j--;) {
+            limb_t *window = u + j, u2 = window[v_len], u1 = window[v_len - 1], q_hat;
+
+            if (u2 == d1 && u1 == d0) {
+                // outside the range of the 3-by-2 step, the quotient limb is `B - 1` or `B - 2`.
+                q_hat = BASE_MAX;
+                limb_t borrow = integer::submul_1(window, v, v_len, q_hat);
+                window[v_len] -= borrow;
+                while (window[v_len]) {
+                    --q_hat;
+                    window[v_len] += integer::add_n(window, window, v, v_len);
+                }
+                q[j] = q_hat;
+                continue;
+            }
+
+            // the top three limbs give the quotient limb or one above it, the remainder of the 3-by-2
+            // step absorbs the borrow of the lower limbs.
+            cast_t r = div_3by2(q_hat, u2, u1, window[v_len - 2], d1, d0, inverse);
+            limb_t borrow = integer::submul_1(window, v, v_len - 2, q_hat);
+            limb_t r0 = (limb_t) r, r1 = (limb_t) (r >> BASE_BITS);
+            limb_t borrow0 = r0 < borrow;
+            r0 = (limb_t) (r0 - borrow);
+            limb_t borrow1 = r1 < borrow0;
+            r1 = (limb_t) (r1 - borrow0);
+
+            window[v_len - 2] = r0;
+            window[v_len] = 0;
+            if (borrow1) {
+                --q_hat;
+                r1 = (limb_t) (r1 + d1 + integer::add_n(window, window, v, v_len - 1));
+            }
+            window[v_len - 1] = r1;
+            q[j] = q_hat;
+        }
+    }
+
+    /// `q = u / v` and `r = u % v` by algorithm D, `v` is the divisor shifted left by `shift` bits
+    /// until its top bit is set. `q` and `r` may share their limbs with `u`.
+    static void divrem_schoolbook(
+        integer &q, integer &r, const limb_t *u, size_t n_len, const limb_t *v, size_t d_len, size_t shift,
+        limb_t inverse
+    ) {
+        limb_t *a = (limb_t *) std::malloc((n_len + 1) * LIMB_BYTES);
+        a[n_len] = lshift_limbs(a, u, n_len, shift);
+
+        size_t q_len = n_len + 1 - d_len;
+        fit_limbs(q, q_len);
+        divrem_knuth(q.limbs, a, n_len + 1, v, d_len, inverse);
+        q.length = q_len;
+        q.remove_leading_zeros();
+
+        fit_limbs(r, d_len);
+        rshift_limbs(r.limbs, a, d_len, shift);
+        r.length = d_len;
+        r.remove_leading_zeros();
+
+        std::free(a);
+    }
+
+    static void div_2n1n(limb_t *q, limb_t *a, const limb_t *b, size_t n, limb_t *scratch);
+
+    /// divides the `3 * h` limbs of `a` by the `2 * h` limbs of `b`, the top `2 * h` limbs of `a` have
+    /// to be less than `b`. The `h` quotient limbs go to `q` and the remainder is left in the low
+    /// `2 * h` limbs of `a`, the top `h` limbs end up zero.
+    static void div_3n2n(limb_t *q, limb_t *a, const limb_t *b, size_t h, limb_t *scratch) {
+        const limb_t *b1 = b + h, *b2 = b;
+        limb_t *a1 = a + h * 2;
+
+        // the top limbs of the dividend over the top half of the divisor estimate the quotient.
+        size_t i = h;
+        while (i && a1[i - 1] == b1[i - 1]) {
+            --i;
+        }
+
+        if (i && a1[i - 1] < b1[i - 1]) {
+            div_2n1n(q, a + h, b1, h, scratch);
+        } else {
+            // `a1 == b1`, the estimate is `B^h - 1` and `a1 * B^h + a2 - (B^h - 1) * b1 = a2 + b1`.
+            std::memset(q, 0xff, h * LIMB_BYTES);
+            std::memset(a1, 0x00, h * LIMB_BYTES);
+            a1[0] = integer::add_n(a + h, a + h, b1, h);
+        }
+
+        // subtracting `q * b2` can take the remainder below zero, `q` is at most two too large.
+        integer::mul_limbs(scratch, h * 2, 0, q, h, 0, b2, h, 0);
+        limb_t negative = sub_1(a1, h, integer::sub_n(a, a, scratch, h * 2));
+        while (negative) {
+            sub_1(q, h, 1);
+            limb_t carry = add_1(a1, h, integer::add_n(a, a, b, h * 2));
+            negative ^= carry;
+        }
+    }
+
+    /// divides the `2 * n` limbs of `a` by the `n` limbs of `b` whose top bit is set, the top `n` limbs
+    /// of `a` have to be less than `b`. The `n` quotient limbs go to `q` and the remainder is left in
+    /// the low `n` limbs of `a`, the top `n` limbs end up zero.
+    static void div_2n1n(limb_t *q, limb_t *a, const limb_t *b, size_t n, limb_t *scratch) {
+        if (n % 2 || n < BURNIKEL_ZIEGLER_SIZE) {
+            divrem_knuth(q, a, n * 2, b, n, reciprocal_3by2(b[n - 1], b[n - 2]));
+            std::memset(a + n, 0x00, n * LIMB_BYTES);
+            return;
+        }
+
+        size_t h = n / 2;
+        div_3n2n(q + h, a + h, b, h, scratch);
+        div_3n2n(q, a, b, h, scratch);
+    }
+
+    /// Burnikel-Ziegler division, `q` and `r` may share their limbs with `u` or `v`.
+    static void divrem_burnikel_ziegler(
+        integer &q, integer &r, const limb_t *u, size_t n_len, const limb_t *v, size_t d_len
+    ) {
+        // the divisor is padded to `m = j * 2^k` limbs with `j < BURNIKEL_ZIEGLER_SIZE` so the
+        // recursion halves evenly down to the schoolbook blocks.
+        size_t j = d_len, k = 0;
+        while (j >= BURNIKEL_ZIEGLER_SIZE) {
+            j = j - j / 2;
+            ++k;
+        }
+        size_t m = j << k, pad = m - d_len, shift = integer::leading_zeros(v[d_len - 1]);
+
+        // the dividend is cut into `blocks` blocks of `m` limbs, the top bit of the top block is zero
+        // so it is less than the normalized divisor.
+        size_t blocks = (n_len + pad + 1 + m - 1) / m;
+        limb_t *a = (limb_t *) std::calloc(blocks * m + m * 2, LIMB_BYTES), *b = a + blocks * m, *scratch = b + m;
+        a[pad + n_len] = lshift_limbs(a + pad, u, n_len, shift);
+        lshift_limbs(b + pad, v, d_len, shift);
+
+        // every block step leaves its remainder as the top half of the next window.
+        size_t q_len = (blocks - 1) * m;
+        fit_limbs(q, q_len);
+        for (size_t i = blocks - 1; i--;) {
+            div_2n1n(q.limbs + i * m, a + i * m, b, m, scratch);
+        }
+        q.length = q_len;
+        q.remove_leading_zeros();
+
+        fit_limbs(r, d_len);
+        rshift_limbs(r.limbs, a + pad, d_len, shift);
+        r.length = d_len;
+        r.remove_leading_zeros();
+
+        std::free(a);
+    }
+
+    // Newton Reciprocal
+    // - `x = floor(B^(k + n) / d)` for a `k` limbs divisor, every iteration `x += x * (B^(k + n) - d * x) / B^(k + n)`
+    //   doubles the correct limbs, so the last and widest iteration costs about as much as all before it.
+    // - below `n + 2 < NEWTON_DIV_SIZE` the reciprocal is one direct division.
+
+    /// @return returns `B^len`.
+    static integer limb_power(size_t len) {
+        integer power(len + 1 + LIMB_GROWTH, len + 1);
+        std::memset(power.limbs, 0x00, len * LIMB_BYTES);
+        power.limbs[len] = 1;
+        return power;
+    }
+
+    /// @return returns `floor(B^(k + n) / d)` off by at most a few units.
+    static integer reciprocal_approx(const limb_t *d, size_t k, size_t n) {
+        // the limbs below the top `n + 2` limbs of the divisor move the result by less than one.
+        if (k > n + 2) {
+            d += k - (n + 2);
+            k = n + 2;
+        }
+
+        integer divisor(const_cast<limb_t *>(d), k, k), x, r;
+        if (n + 2 < NEWTON_DIV_SIZE) {
+            integer power = limb_power(k + n);
+            integer::div_mod(x, r, power, divisor);
+            divisor.detach();
+            return x;
+        }
+
+        // `h` limbs square to a relative error below `B^-(n + 3)`, the lifted `x` is precise enough.
+        size_t h = n / 2 + 2;
+        x = reciprocal_approx(d, k, h) << ((n - h) * LIMB_BITS);
+
+        // `d * x` is within `B^(k + n - h + 1)` of `B^(k + n)`, its low limbs alone give the signed error.
+        size_t low_len = k + n - h + 2;
+        integer e = mul_low(divisor, x, low_len);
+        divisor.detach();
+
+        bool below = e.length == low_len && (e.limbs[low_len - 1] >> BASE_BITS_MINUS1);
+        if (below) {
+            e = limb_power(low_len) - e;
+            x += mul_high(x, e, k + n);
+        } else {
+            x -= mul_high(x, e, k + n);
+        }
+        return x;
+    }
+
+    integer integer::reciprocal(size_t n_limbs) const {
+        if (!*this) {
+            throw std::domain_error("integer - reciprocal : division by zero");
+        }
+
+        integer x = reciprocal_approx(limbs, length, n_limbs);
+
+        // the approximation is moved onto the exact floor, `B^(length + n_limbs) - *this * x` lies within
+        // a few divisors of zero and its low `length + 1` limbs hold it in two's complement.
+        size_t len = length + 1;
+        integer rem(len + LIMB_GROWTH, len), low = mul_low(*this, x, len);
+        std::memset(rem.limbs, 0x00, len * LIMB_BYTES);
+        sub_1(rem.limbs + low.length, len - low.length, integer::sub_n(rem.limbs, rem.limbs, low.limbs, low.length));
+
+        while (rem.limbs[len - 1] >> BASE_BITS_MINUS1) {
+            add_1(rem.limbs + length, 1, integer::add_n(rem.limbs, rem.limbs, limbs, length));
+            --x;
+        }
+
+        rem.remove_leading_zeros();
+        while (rem >= *this) {
+            rem -= *this;
+            ++x;
+        }
+        return x;
+    }
+
+    /// `q = n / d` and `r = n % d` for `n < d * B^p`, `x` is `d.reciprocal(p)` or within a few units
+    /// of it. The quotient estimate `(n / B^(k - 1)) * x / B^(p + 1)` is then within a few units of the
+    /// true one.
+    static void div_reciprocal_block(
+        integer &q, integer &r, const integer &n, const integer &d, const integer &x, size_t p
+    ) {
+        size_t k = d.length;
+        if (n < d) {
+            q = __INTEGER_ZERO;
+            r = n;
+            return;
+        }
+
+        integer top(n.limbs + k - 1, n.length - k + 1, n.length - k + 1);
+        q = mul_high(top, x, p + 1);
+        top.detach();
+
+        // the remainder lies within a few divisors of zero, the low `k + 1` limbs of `n - q * d` hold
+        // it in two's complement.
+        size_t len = k + 1;
+        integer rem(len + LIMB_GROWTH, len), low = mul_low(q, d, len);
+        std::memset(rem.limbs, 0x00, len * LIMB_BYTES);
+        std::memcpy(rem.limbs, n.limbs, std::min(n.length, len) * LIMB_BYTES);
+        sub_1(rem.limbs + low.length, len - low.length, integer::sub_n(rem.limbs, rem.limbs, low.limbs, low.length));
+
+        while (rem.limbs[len - 1] >> BASE_BITS_MINUS1) {
+            add_1(rem.limbs + k, 1, integer::add_n(rem.limbs, rem.limbs, d.limbs, k));
+            --q;
+        }
+
+        rem.remove_leading_zeros();
+        while (rem >= d) {
+            rem -= d;
+            ++q;
+        }
+        r = std::move(rem);
+    }
+
+    void integer::div_mod(
+        integer &q, integer &r, integer &dividen, const integer &divisor, const integer &reciprocal, size_t n_limbs
+    ) {
+        if (!divisor) {
+            throw std::domain_error("integer - div_mod : division by zero");
+        }
+
+        if (dividen < divisor) {
+            if (&r != &dividen) {
+                r = dividen;
+            }
+            q = __INTEGER_ZERO;
+            return;
+        }
+
+        // the quotient is produced from the top in blocks of at most `n_limbs` limbs, every block
+        // divides the last remainder joined with the next dividend limbs.
+        size_t k = divisor.length, q_len = dividen.length - k + 1;
+        size_t blocks = (q_len + n_limbs - 1) / n_limbs, rest = (blocks - 1) * n_limbs;
+
+        integer quotient(q_len + LIMB_GROWTH, q_len), block_q, rem;
+        std::memset(quotient.limbs, 0x00, q_len * LIMB_BYTES);
+
+        integer window = dividen >> (rest * LIMB_BITS);
+        for (size_t i = blocks; i--;) {
+            div_reciprocal_block(block_q, rem, window, divisor, reciprocal, n_limbs);
+            if (block_q) {
+                std::memcpy(quotient.limbs + i * n_limbs, block_q.limbs, block_q.length * LIMB_BYTES);
+            }
+
+            if (i) {
+                size_t len = n_limbs + rem.length;
+                window = integer(len + LIMB_GROWTH, len);
+                std::memcpy(window.limbs, dividen.limbs + (i - 1) * n_limbs, n_limbs * LIMB_BYTES);
+                std::memcpy(window.limbs + n_limbs, rem.limbs, rem.length * LIMB_BYTES);
+                window.remove_leading_zeros();
+            }
+        }
+
+        quotient.remove_leading_zeros();
+        q = std::move(quotient);
+        r = std::move(rem);
+    }
+
+    void integer::div_mod(integer &q, integer &r, integer &dividen, const integer &divisor) {
+        if (!divisor) {
+            throw std::domain_error("integer - div_mod : division by zero");
+        }
+
+        if (dividen < divisor) {
+            if (&r != &dividen) {
+                r = dividen;
+            }
+            q = __INTEGER_ZERO;
+            return;
+        }
+
+        size_t n_len = dividen.length, d_len = divisor.length;
+
+        if (d_len == 1) {
+            // the quotient limbs are written from the top, `q` may be `dividen` itself.
+            if (&q != &dividen) {
+                fit_limbs(q, n_len);
+            }
+
+            size_t shift = leading_zeros(divisor.limbs[0]);
+            limb_t normal = divisor.limbs[0] << shift;
+            limb_t remainder = divrem_1(q.limbs, dividen.limbs, n_len, normal, shift, reciprocal_2by1(normal));
+
+            q.length = n_len;
+            q.remove_leading_zeros();
+            r = remainder;
+            return;
+        }
+
+        if (d_len >= NEWTON_DIV_SIZE && n_len - d_len >= NEWTON_DIV_SIZE) {
+            // the blocks correct the quotient both ways, the reciprocal may skip its exact rounding.
+            size_t q_len = n_len - d_len + 1;
+            integer::div_mod(q, r, dividen, divisor, reciprocal_approx(divisor.limbs, d_len, q_len), q_len);
+            return;
+        }
+
+        if (d_len >= BURNIKEL_ZIEGLER_SIZE && n_len - d_len >= BURNIKEL_ZIEGLER_SIZE) {
+            divrem_burnikel_ziegler(q, r, dividen.limbs, n_len, divisor.limbs, d_len);
+            return;
+        }
+
+        size_t shift = leading_zeros(divisor.limbs[d_len - 1]);
+        limb_t *v = (limb_t *) std::malloc(d_len * LIMB_BYTES);
+        lshift_limbs(v, divisor.limbs, d_len, shift);
+        divrem_schoolbook(q, r, dividen.limbs, n_len, v, d_len, shift, reciprocal_3by2(v[d_len - 1], v[d_len - 2]));
+        std::free(v);
+    }
+
+    divisor::divisor(const integer &d) : number(d), normal(d) {
+        if (!d) {
+            throw std::domain_error("divisor - divisor : division by zero");
+        }
+
+        shift = integer::leading_zeros(number.limbs[number.length - 1]);
+        lshift_limbs(normal.limbs, number.limbs, number.length, shift);
+
+        if (number.length == 1) {
+            inverse = integer::reciprocal_2by1(normal.limbs[0]);
+        } else {
+            inverse = reciprocal_3by2(normal.limbs[normal.length - 1], normal.limbs[normal.length - 2]);
+        }
+    }
+
+    const integer &divisor::number_view() const noexcept {
+        return number;
+    }
+
+    void divmod(integer &q, integer &r, const integer &n, const divisor &d) {
+        if (n < d.number) {
+            if (&r != &n) {
+                r = n;
+            }
+            q = __INTEGER_ZERO;
+            return;
+        }
+
+        size_t n_len = n.length, d_len = d.number.length;
+
+        if (d_len == 1) {
+            // the quotient limbs are written from the top, `q` may be `n` itself.
+            if (&q != &n) {
+                fit_limbs(q, n_len);
+            }
+
+            limb_t remainder = integer::divrem_1(q.limbs, n.limbs, n_len, d.normal.limbs[0], d.shift, d.inverse);
+            q.length = n_len;
+            q.remove_leading_zeros();
+            r = remainder;
+            return;
+        }
+
+        // the recursive tiers gain nothing from the prepared top limbs.
+        if (d_len >= BURNIKEL_ZIEGLER_SIZE && n_len - d_len >= BURNIKEL_ZIEGLER_SIZE) {
+            integer::div_mod(q, r, const_cast<integer &>(n), d.number);
+            return;
+        }
+
+        divrem_schoolbook(q, r, n.limbs, n_len, d.normal.limbs, d_len, d.shift, d.inverse);
+    }
+
+    integer &integer::operator/=(const integer &op) {
+        integer remainder;
+        div_mod(*this, remainder, *this, op);
+        return *this;
+    }
+
+    integer &integer::operator%=(const integer &op) {
+        integer quotient;
+        div_mod(quotient, *this, *this, op);
+        return *this;
+    }
+
+    integer integer::operator/(const integer &op) const {
+        integer quotient = *this;
+        return quotient /= op;
+    }
+
+    integer integer::operator%(const integer &op) const {
+        integer remainder = *this;
+        return remainder %= op;
+    }
+
+    // Exact Division
+    // - a divisor known to divide the dividend is inverted modulo `B` (Hensel), every quotient limb is
+    //   the low dividend limb times that inverse and the quotient grows from the low end without any
+    //   correction step.
+    // - from `JEBELEAN_SIZE` limbs of divisor and quotient the division runs from both ends
+    //   (Jebelean), the low half comes from a 2-adic newton inverse and `mul_low`, the high half from
+    //   a division of the top limbs only, one overlapping limb joins both halves.
+
+    limb_t binvert_limb(limb_t d) {
+        // `3 * d ^ 2` is the inverse of any odd `d` modulo `2^5`, every newton step doubles the bits.
+        limb_t inverse = (limb_t) ((limb_t) (3 * d) ^ 2);
+        for (size_t bits = 5; bits < BASE_BITS; bits *= 2) {
+            inverse = (limb_t) ((cast_t) inverse * (limb_t) (2 - (limb_t) ((cast_t) d * inverse)));
+        }
+        return inverse;
+    }
+
+    void divexact_hensel(limb_t *q, limb_t *u, size_t q_len, const limb_t *d, size_t d_len, limb_t inverse) {
+        for (size_t i = 0; i < q_len; ++i) {
+            limb_t q_limb = (limb_t) ((cast_t) u[i] * inverse);
+
+            // the product is only subtracted up to limb `q_len`, the limbs above it are never read.
+            size_t span = std::min(d_len, q_len - i);
+            limb_t borrow = integer::submul_1(u + i, d, span, q_limb);
+            sub_1(u + i + span, q_len - i - span, borrow);
+            q[i] = q_limb;
+        }
+    }
+
+    /// @return returns `d^-1 mod B^n` for the `d_len` limbs of an odd `d`.
+    static integer binvert(const limb_t *d, size_t d_len, size_t n) {
+        if (n == 1) {
+            return integer({binvert_limb(d[0])});
+        }
+
+        // `d * x = 1 + e * B^h (mod B^n)` for the inverse `x` of `h` limbs, `x - x * e * B^h` is the
+        // inverse of `n` limbs.
+        size_t h = (n + 1) / 2;
+        integer x = binvert(d, d_len, h);
+        size_t d_low = std::min(d_len, n);
+        integer divisor(const_cast<limb_t *>(d), d_low, d_low);
+        integer e = mul_low(divisor, x, n);
+        divisor.detach();
+
+        integer inverse(n + LIMB_GROWTH, n);
+        std::memset(inverse.limbs, 0x00, n * LIMB_BYTES);
+        std::memcpy(inverse.limbs, x.limbs, x.length * LIMB_BYTES);
+        if (e.length > h) {
+            integer e_high(e.limbs + h, e.length - h, e.length - h);
+            integer t = mul_low(x, e_high, n - h);
+            e_high.detach();
+
+            // adds `-t mod B^(n - h)` above the low `h` limbs.
+            limb_t *high = inverse.limbs + h;
+            std::memset(high, 0x00, (n - h) * LIMB_BYTES);
+            sub_1(high + t.length, n - h - t.length, integer::sub_n(high, high, t.limbs, t.length));
+        }
+        inverse.remove_leading_zeros();
+        return inverse;
+    }
+
+    /// @return returns `n / d` for an odd `d` that divides `n`, the low `l + 1` quotient limbs come from
+    /// the 2-adic inverse and the high limbs from the top `h + 2` limbs of `d`.
+    static integer divexact_jebelean(const integer &n, const integer &d) {
+        size_t q_len = n.length - d.length + 1, l = q_len / 2, h = q_len - l;
+
+        size_t n_low_len = std::min(n.length, l + 1);
+        integer n_low(n.limbs, n_low_len, n_low_len);
+        integer low = mul_low(n_low, binvert(d.limbs, d.length, l + 1), l + 1);
+        n_low.detach();
+
+        // the truncated operands give `floor(q / B^l)` or one of its neighbours, the exact limb `l`
+        // of the low half picks the right one.
+        size_t t = std::min(d.length, h + 2), skip = d.length - t + l;
+        integer top_n(n.limbs + skip, n.length - skip, n.length - skip), top_d(d.limbs + d.length - t, t, t), x, r;
+        integer::div_mod(x, r, top_n, top_d);
+        top_n.detach();
+        top_d.detach();
+
+        limb_t overlap = low.length > l ? low.limbs[l] : 0;
+        if ((limb_t) (x.limbs[0] - 1) == overlap) {
+            --x;
+        } else if (x.limbs[0] != overlap) {
+            ++x;
+        }
+
+        integer q(q_len + LIMB_GROWTH, q_len);
+        std::memset(q.limbs, 0x00, q_len * LIMB_BYTES);
+        std::memcpy(q.limbs, low.limbs, std::min(low.length, l) * LIMB_BYTES);
+        std::memcpy(q.limbs + l, x.limbs, std::min(x.length, h) * LIMB_BYTES);
+        q.remove_leading_zeros();
+        return q;
+    }
+
+    integer divexact(const integer &n, const integer &d) {
+        if (!d) {
+            throw std::domain_error("integer - divexact : division by zero");
+        }
+
+        if (n < d) {
+            return __INTEGER_ZERO;
+        }
+
+        // the common factor `2^zeros` is dropped so the divisor is odd.
+        size_t zeros = 0;
+        while (!d.limbs[zeros / BASE_BITS]) {
+            zeros += BASE_BITS;
+        }
+        for (limb_t low = d.limbs[zeros / BASE_BITS]; !(low & 1); low >>= 1) {
+            ++zeros;
+        }
+
+        if (zeros) {
+            return divexact(n >> zeros, d >> zeros);
+        }
+
+        size_t q_len = n.length - d.length + 1;
+        if (q_len >= JEBELEAN_SIZE && d.length >= JEBELEAN_SIZE) {
+            return divexact_jebelean(n, d);
+        }
+
+        integer q(q_len + LIMB_GROWTH, q_len);
+        std::memcpy(q.limbs, n.limbs, q_len * LIMB_BYTES);
+        divexact_hensel(q.limbs, q.limbs, q_len, d.limbs, d.length, binvert_limb(d.limbs[0]));
+        q.remove_leading_zeros();
+        return q;
+    }
+
+    // Small Moduli
+    // - a single limb modulus is normalized once and the dividend is read from its top limb down
+    //   with the Möller-Granlund reciprocal, no quotient limb is stored.
+    // - `B^3 = 1 (mod 2^K - 1)` for `K = 3/4 * BASE_BITS`, so `n mod (2^K - 1)` is a sum of the limbs
+    //   in three columns and a few folds, every modulus of a batch that divides `2^K - 1` is taken from
+    //   that residue. The other moduli are multiplied together while the product fits in a limb and
+    //   every product costs one pass over `n`.
+    // - an odd `d` divides `n` exactly when the Hensel division of `n` by `d` leaves no borrow
+    //   (Granlund-Montgomery), `d * inverse = 1 (mod B)` replaces every division by a multiplication.
+
+    static const size_t FOLD_BITS = BASE_BITS / 4 * 3;
+    static const limb_t FOLD_MODULUS = ((limb_t) 1 << FOLD_BITS) - 1;
+
+    /// @return returns `x mod (2^FOLD_BITS - 1)`.
+    static limb_t fold_mersenne(cast_t x) {
+        while (x >> FOLD_BITS) {
+            x = (x & FOLD_MODULUS) + (x >> FOLD_BITS);
+        }
+        return x == FOLD_MODULUS ? 0 : (limb_t) x;
+    }
+
+    /// @return returns `n mod (2^FOLD_BITS - 1)` from additions only.
+    static limb_t mod_mersenne(const limb_t *n, size_t len) {
+        // `len < B` so each column sum fits in two limbs.
+        cast_t column[3] = {0, 0, 0};
+        size_t i = 0;
+        for (; i + 3 <= len; i += 3) {
+            column[0] += n[i];
+            column[1] += n[i + 1];
+            column[2] += n[i + 2];
+        }
+        for (size_t j = 0; i < len; ++i, ++j) {
+            column[j] += n[i];
+        }
+
+        // `B = 2^(FOLD_BITS / 3) (mod 2^FOLD_BITS - 1)`.
+        return fold_mersenne(
+            (cast_t) fold_mersenne(column[0]) +
+            ((cast_t) fold_mersenne(column[1]) << (FOLD_BITS / 3)) +
+            ((cast_t) fold_mersenne(column[2]) << (FOLD_BITS / 3 * 2))
+        );
+    }
+
+    /// @return returns `n mod m` for a non zero `m`.
+    static limb_t mod_1(const limb_t *n, size_t len, limb_t m) {
+        if (len == 1) {
+            return n[0] % m;
+        }
+
+        size_t shift = integer::leading_zeros(m);
+        limb_t normal = (limb_t) (m << shift);
+        return integer::divrem_1(nullptr, n, len, normal, shift, integer::reciprocal_2by1(normal));
+    }
+
+    limb_t mod_small(const integer &n, limb_t m) {
+        if (!m) {
+            throw std::domain_error("integer - mod_small : division by zero");
+        }
+        return mod_1(n.limbs, n.length, m);
+    }
+
+    void mod_small(limb_t *residues, const integer &n, const limb_t *moduli, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            if (!moduli[i]) {
+                throw std::domain_error("integer - mod_small : division by zero");
+            }
+        }
+
+        limb_t mersenne = mod_mersenne(n.limbs, n.length);
+
+        size_t i = 0;
+        while (i < count) {
+            if (FOLD_MODULUS % moduli[i] == 0) {
+                residues[i] = mersenne % moduli[i];
+                ++i;
+                continue;
+            }
+
+            // the moduli from `i` to `end` that do not divide `2^FOLD_BITS - 1` share one pass.
+            limb_t product = moduli[i];
+            size_t end = i + 1;
+            for (; end < count; ++end) {
+                if (FOLD_MODULUS % moduli[end] == 0) {
+                    continue;
+                }
+                if (product > BASE_MAX / moduli[end]) {
+                    break;
+                }
+                product = (limb_t) (product * moduli[end]);
+            }
+
+            limb_t residue = mod_1(n.limbs, n.length, product);
+            for (; i < end; ++i) {
+                residues[i] = FOLD_MODULUS % moduli[i] ? residue % moduli[i] : mersenne % moduli[i];
+            }
+        }
+    }
+
+    bool divisible(const integer &n, limb_t d) {
+        if (!d) {
+            throw std::domain_error("integer - divisible : division by zero");
+        }
+
+        // the factor `2^zeros` only has to match the trailing zero bits of `n`.
+        size_t zeros = 0;
+        for (; !(d & 1); d >>= 1) {
+            ++zeros;
+        }
+        if (n.limbs[0] & (((limb_t) 1 << zeros) - 1)) {
+            return false;
+        }
+        if (d == 1) {
+            return true;
+        }
+
+        // `n - borrow * B^len = d * q` after the loop, `d` divides `n` iff it divides the final
+        // borrow, which is at most `d`.
+        limb_t inverse = binvert_limb(d), borrow = 0;
+        for (size_t i = 0; i < n.length; ++i) {
+            limb_t low = (limb_t) (n.limbs[i] - borrow);
+            borrow = low > n.limbs[i];
+            limb_t q_limb = (limb_t) ((cast_t) low * inverse);
+            borrow = (limb_t) (borrow + (limb_t) (((cast_t) q_limb * d) >> BASE_BITS));
+        }
+        return !borrow || borrow == d;
+    }
+
+    // pre-fix increment/decrement
+    integer &integer::operator++() noexcept {
+        return *this += __INTEGER_ONE;
+    }
+
+    integer &integer::operator--() noexcept {
+        return *this -= __INTEGER_ONE;
+    }
+
+    // post-fix increment/decrement
+    integer integer::operator++(int) noexcept {
+        integer prev = *this;
+        ++*this;
+        return prev;
+    }
+
+    integer integer::operator--(int) noexcept {
+        integer prev = *this;
+        --*this;
+        return prev;
+    }
+
+    // Shift Operators
+    integer &integer::operator<<=(size_t bits) noexcept {
+        if (*this && bits) {
+            size_t limb_shifts = bits / BASE_BITS;
+            size_t bit_shifts = bits % BASE_BITS;
+            size_t new_length = length + limb_shifts + 1;
+            size_t zero_limbs = new_length - length - 1;
+
+            if (new_length > capacity) {
+                capacity = new_length + LIMB_GROWTH;
+                limbs = (limb_t *) std::realloc(limbs, capacity * LIMB_BYTES);
+            }
+
+            limbs[new_length - 1] = 0;
+
+            for (size_t i = 0; i < length; ++i) {
+                cast_t temp_shift = limbs[length - 1 - i];
+                temp_shift <<= bit_shifts;
+                limbs[new_length - 1 - i] |= temp_shift >> BASE_BITS;
+                limbs[new_length - 2 - i] = temp_shift;
+            }
+
+            if (zero_limbs) {
+                std::memset(limbs, 0x00, zero_limbs * LIMB_BYTES);
+            }
+
+            length = new_length;
+            length -= !limbs[length - 1];
+        }
+        return *this;
+    }
+
+    integer &integer::operator>>=(size_t bits) noexcept {
+        if (*this && bits) {
+            size_t limb_shifts = bits / BASE_BITS;
+            if (limb_shifts >= length) {
+                length = 1;
+                limbs[0] = 0;
+            } else {
+                size_t bit_shifts = bits % BASE_BITS;
+                size_t new_length = length - limb_shifts;
+
+                // initial limb shift
+                limbs[0] = limbs[limb_shifts] >> bit_shifts;
+
+                // looped shifts
+                for (size_t i = 1; i < new_length; ++i) {
+                    cast_t temp_shift = limbs[i + limb_shifts];
+                    temp_shift = (temp_shift << BASE_BITS) >> bit_shifts;
+                    limbs[i - 1] |= temp_shift;
+                    limbs[i] = temp_shift >> BASE_BITS;
+                }
+
+                length = new_length;
+                length -= !limbs[length - 1] && length != 1;
+            }
+        }
+        return *this;
+    }
+
+    integer integer::operator<<(size_t bits) const noexcept {
+        integer shifted = *this;
+        return shifted <<= bits;
+    }
+
+    integer integer::operator>>(size_t bits) const noexcept {
+        integer shifted = *this;
+        return shifted >>= bits;
+    }
+
+    void integer::printBin_spaced_out() const {
+        for (size_t i = 0; i < length; ++i) {
+            std::cout << std::bitset<BASE_BITS>(limbs[length - 1 - i]) << " ";
+        }
+        std::cout << "\n";
+    }
+
+    // Decimal Conversion
+    // - the basecase peels `BASE10_CHUNK_DIGITS` digits per single limb division by `BASE10_CHUNK`.
+    // - from `TO_STRING_DC_SIZE` limbs the integer is split by a power `10^(BASE10_CHUNK_DIGITS * 2^k)`
+    //   close to its square root, both halves are converted on their own and the lower half is padded
+    //   with zeros. The powers are squared once per thread and kept for the next conversions.
+
+    /// @return returns `10^(BASE10_CHUNK_DIGITS * 2^k)` at index `k` for every `k <= level`.
+    static const std::vector<integer> &base10_powers(size_t level) {
+        static thread_local std::vector<integer> powers(1, integer(BASE10_CHUNK));
+        while (powers.size() <= level) {
+            powers.push_back(powers.back().square());
+        }
+        return powers;
+    }
+
+    /// appends the digits of `n` to `out`, padded with zeros to `digits` digits when `digits` is not 0.
+    static void base10_basecase(std::string &out, integer n, size_t digits) {
+        size_t start = out.size();
+        while (n) {
+            limb_t chunk = n.divrem_by<BASE10_CHUNK>();
+            for (size_t i = 0; i < BASE10_CHUNK_DIGITS && (n || chunk); ++i) {
+                out.push_back('0' + chunk % 10);
+                chunk /= 10;
+            }
+        }
+
+        while (out.size() - start < digits) {
+            out.push_back('0');
+        }
+        std::reverse(out.begin() + start, out.end());
+    }
+
+    /// appends the digits of `n` to `out` padded like `base10_basecase`, a padded `n` is always below
+    /// `powers[level]`.
+    static void base10_recursive(
+        std::string &out, const integer &n, size_t digits, const std::vector<integer> &powers, size_t level
+    ) {
+        if (!level || n.length < TO_STRING_DC_SIZE) {
+            base10_basecase(out, n, digits);
+            return;
+        }
+
+        const integer &power = powers[--level];
+        if (!digits && n < power) {
+            base10_recursive(out, n, 0, powers, level);
+            return;
+        }
+
+        integer high, low, dividen = n;
+        integer::div_mod(high, low, dividen, power);
+
+        size_t low_digits = BASE10_CHUNK_DIGITS << level;
+        base10_recursive(out, high, digits ? digits - low_digits : 0, powers, level);
+        base10_recursive(out, low, low_digits, powers, level);
+    }
+
+    std::string integer::to_base10_string() const {
+        std::string Base10;
+        Base10.reserve(length * BASE10_CHUNK_DIGITS + BASE10_CHUNK_DIGITS);
+        if (!*this) {
+            Base10 = "0";
+            return Base10;
+        }
+
+        // the top split is by the smallest power whose square is above the integer.
+        size_t level = 1;
+        while (length >= TO_STRING_DC_SIZE && base10_powers(level - 1)[level - 1].length * 2 - 1 <= length) {
+            ++level;
         }
+        base10_recursive(Base10, *this, 0, base10_powers(level - 1), level);
         return Base10;
     }
 
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <cstring>
 #include <exception>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <vector>
@@ -69,8 +70,18 @@ namespace apa {
     constexpr static size_t INITIAL_LIMB_LENGTH = 1;
     constexpr static size_t LIMB_GROWTH = 2;
 
+    /// operands up to this many limbs use the unrolled fixed size kernels.
+    constexpr static size_t FIXED_LIMBS = 8;
+
     constexpr static limb_t BASE_MAX = std::numeric_limits<limb_t>::max();
 
+    /// digits of the largest power of ten that fits a limb.
+    constexpr static size_t BASE10_CHUNK_DIGITS = BASE_BITS == 64 ? 19 : BASE_BITS == 32 ? 9 : 4;
+
+    /// `10^BASE10_CHUNK_DIGITS`, the chunk the decimal conversion divides by.
+    constexpr static limb_t BASE10_CHUNK =
+        BASE_BITS == 64 ? (limb_t) 10000000000000000000ull : BASE_BITS == 32 ? (limb_t) 1000000000u : (limb_t) 10000u;
+
     struct integer {
         size_t capacity;
         size_t length;
@@ -117,8 +128,22 @@ namespace apa {
 
         // Arithmetic Operators
         integer bit_division(const integer &op) const;
+
+        /// `q = dividen / divisor` and `r = dividen % divisor`, `q` or `r` may be `dividen` itself,
+        /// throws `std::domain_error` when `divisor` is zero.
         static void div_mod(integer& q, integer& r, integer& dividen, const integer& divisor);
 
+        /// `div_mod` with a precomputed `reciprocal = divisor.reciprocal(n_limbs)`, the quotient is
+        /// produced in blocks of `n_limbs` limbs that cost two multiplications each.
+        static void div_mod(
+            integer &q, integer &r, integer &dividen, const integer &divisor, const integer &reciprocal,
+            size_t n_limbs
+        );
+
+        /// @return returns `floor(B^(length + n_limbs) / *this)` by newton iteration, throws
+        /// `std::domain_error` when the integer is zero.
+        integer reciprocal(size_t n_limbs) const;
+
         integer &operator+=(const integer &op) noexcept;
         integer &operator-=(const integer &op) noexcept;
         integer &operator*=(const integer &op) noexcept;
@@ -127,6 +152,103 @@ namespace apa {
         integer operator+(const integer &op) const noexcept;
         integer operator-(const integer &op) const noexcept;
         integer operator*(const integer &op) const noexcept;
+        integer operator/(const integer &op) const;
+        integer operator%(const integer &op) const;
+
+        /// @return returns the square of the integer, cross products are only computed once.
+        integer square() const noexcept;
+
+        // Multiplication Kernels
+        // - the output range of `l_len + r_len` limbs starting at `out_index` is fully overwritten.
+
+        static void mul_limbs(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *l, size_t l_len, size_t l_index,
+            const limb_t *r, size_t r_len, size_t r_index
+        );
+
+        static void mul_basecase(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *l, size_t l_len, size_t l_index,
+            const limb_t *r, size_t r_len, size_t r_index
+        );
+
+        static void mul_karatsuba(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *l, size_t l_len, size_t l_index,
+            const limb_t *r, size_t r_len, size_t r_index
+        );
+
+        static void mul_toom3(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *l, size_t l_len, size_t l_index,
+            const limb_t *r, size_t r_len, size_t r_index
+        );
+
+        static void mul_unbalanced(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *l, size_t l_len, size_t l_index,
+            const limb_t *r, size_t r_len, size_t r_index
+        );
+
+        /// three prime number-theoretic transform with CRT recombination.
+        static void mul_ntt(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *l, size_t l_len, size_t l_index,
+            const limb_t *r, size_t r_len, size_t r_index
+        );
+
+        /// @return true if a product of `product_len` limbs fits the transform length of `mul_ntt`.
+        static bool ntt_supported(size_t product_len) noexcept;
+
+        // Squaring Kernels
+        // - the output range of `2 * len` limbs starting at `out_index` is fully overwritten.
+
+        static void sqr_limbs(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *num, size_t len, size_t index
+        );
+
+        static void sqr_basecase(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *num, size_t len, size_t index
+        );
+
+        static void sqr_karatsuba(
+            limb_t *out, size_t out_len, size_t out_index, const limb_t *num, size_t len, size_t index
+        );
+
+        // Limb Kernels
+
+        /// `out += l * r` over `n` limbs, @return the carry out.
+        static limb_t addmul_1(limb_t *out, const limb_t *l, size_t n, limb_t r) noexcept;
+
+        /// `out = l + r` over `n` limbs, `out` may alias either operand, @return the carry out.
+        static limb_t add_n(limb_t *out, const limb_t *l, const limb_t *r, size_t n) noexcept;
+
+        /// `out = l - r` over `n` limbs, `out` may alias either operand, @return the borrow out.
+        static limb_t sub_n(limb_t *out, const limb_t *l, const limb_t *r, size_t n) noexcept;
+
+        /// `out -= l * r` over `n` limbs, @return the borrow out.
+        static limb_t submul_1(limb_t *out, const limb_t *l, size_t n, limb_t r) noexcept;
+
+        /// @return returns the number of leading zero bits of a non zero limb.
+        static constexpr size_t leading_zeros(limb_t limb) noexcept;
+
+        /// @return returns the Möller-Granlund reciprocal `floor((B^2 - 1) / d) - B` of a limb `d`
+        /// with its top bit set.
+        static constexpr limb_t reciprocal_2by1(limb_t d) noexcept;
+
+        /// `q = <u1, u0> / d` for `u1 < d`, `v` is `reciprocal_2by1(d)`, @return the remainder.
+        static limb_t div_2by1(limb_t &q, limb_t u1, limb_t u0, limb_t d, limb_t v) noexcept;
+
+        /// `q = n / (d >> shift)` over `len` limbs where `d` has its top bit set and `v` is
+        /// `reciprocal_2by1(d)`, @return the remainder. `q` may be `n` itself or null.
+        static limb_t divrem_1(limb_t *q, const limb_t *n, size_t len, limb_t d, size_t shift, limb_t v) noexcept;
+
+        // Division by Constants
+        // - the normalization shift and the reciprocal of `D` are folded at compile time, every limb
+        //   costs two multiplications and at most two corrections.
+
+        /// `*this /= D`, @return the remainder.
+        template <limb_t D>
+        limb_t divrem_by() noexcept;
+
+        /// @return returns `*this % D`.
+        template <limb_t D>
+        limb_t mod_by() const noexcept;
 
         // pre-fix increment/decrement
         integer &operator++() noexcept;
@@ -148,7 +270,8 @@ namespace apa {
         void printBin_spaced_out() const;
 
         /// @return returns a string that represent the value of a integer number in
-        /// base 10 form or decimal.
+        /// base 10 form or decimal, from `TO_STRING_DC_SIZE` limbs the integer is split in halves by
+        /// powers of ten.
         std::string to_base10_string() const;
 
         /// @return returns a string that represent the value of a integer number in
@@ -161,9 +284,163 @@ namespace apa {
         limb_t *detach();
     };
 
+    constexpr size_t integer::leading_zeros(limb_t limb) noexcept {
+        return limb >> BASE_BITS_MINUS1 ? 0 : 1 + leading_zeros((limb_t) (limb << 1));
+    }
+
+    constexpr limb_t integer::reciprocal_2by1(limb_t d) noexcept {
+        return (limb_t) (((((cast_t) (limb_t) ~d) << BASE_BITS) | BASE_MAX) / d);
+    }
+
+    inline limb_t integer::div_2by1(limb_t &q, limb_t u1, limb_t u0, limb_t d, limb_t v) noexcept {
+        cast_t p = (cast_t) v * u1 + (((cast_t) u1 << BASE_BITS) | u0);
+        limb_t q1 = (limb_t) ((limb_t) (p >> BASE_BITS) + 1), q0 = (limb_t) p;
+        limb_t r = (limb_t) (u0 - (limb_t) ((cast_t) q1 * d));
+
+        if (r > q0) {
+            --q1;
+            r = (limb_t) (r + d);
+        }
+        if (r >= d) {
+            ++q1;
+            r = (limb_t) (r - d);
+        }
+        q = q1;
+        return r;
+    }
+
+    inline limb_t integer::divrem_1(
+        limb_t *q, const limb_t *n, size_t len, limb_t d, size_t shift, limb_t v
+    ) noexcept {
+        limb_t r = 0, q_limb;
+        if (!shift) {
+            for (size_t i = len; i--;) {
+                r = div_2by1(q ? q[i] : q_limb, r, n[i], d, v);
+            }
+            return r;
+        }
+
+        // the dividend is shifted along, `q[i]` is written after the last read of `n[i]`.
+        r = n[len - 1] >> (BASE_BITS - shift);
+        for (size_t i = len; i--;) {
+            limb_t low = i ? n[i - 1] >> (BASE_BITS - shift) : 0;
+            r = div_2by1(q ? q[i] : q_limb, r, (limb_t) (n[i] << shift) | low, d, v);
+        }
+        return r >> shift;
+    }
+
+    template <limb_t D>
+    limb_t integer::divrem_by() noexcept {
+        static_assert(D != 0, "integer - divrem_by : division by zero");
+        constexpr size_t shift = leading_zeros(D);
+        constexpr limb_t normal = (limb_t) (D << shift), inverse = reciprocal_2by1(normal);
+
+        limb_t remainder = divrem_1(limbs, limbs, length, normal, shift, inverse);
+        remove_leading_zeros();
+        return remainder;
+    }
+
+    template <limb_t D>
+    limb_t integer::mod_by() const noexcept {
+        static_assert(D != 0, "integer - mod_by : division by zero");
+        constexpr size_t shift = leading_zeros(D);
+        constexpr limb_t normal = (limb_t) (D << shift), inverse = reciprocal_2by1(normal);
+
+        return divrem_1(nullptr, limbs, length, normal, shift, inverse);
+    }
+
+    class bint;
+
+    /// a divisor prepared for many divisions, the normalization shift and the Möller-Granlund
+    /// reciprocal of its top limbs are computed once so `divmod` runs without hardware divisions.
+    class divisor {
+        private:
+
+        integer number;
+        integer normal;
+        size_t shift;
+        limb_t inverse;
+
+        public:
+
+        /// throws `std::domain_error` when `d` is zero.
+        divisor(const integer &d);
+
+        /// prepares the magnitude of `d`, its sign is ignored. Throws `std::domain_error` when `d`
+        /// is zero.
+        divisor(const bint &d);
+
+        const integer &number_view() const noexcept;
+
+        friend void divmod(integer &q, integer &r, const integer &n, const divisor &d);
+    };
+
+    /// `q = n / d` and `r = n % d`, `q` or `r` may be `n` itself.
+    void divmod(integer &q, integer &r, const integer &n, const divisor &d);
+
     // functions
     void swap(integer &a, integer &b);
 
+    /// @return returns `(a * b) mod B^n`, the low `n` limbs of the product.
+    integer mul_low(const integer &a, const integer &b, size_t n);
+
+    /// @return returns `(a * b) / B^n`, the product without its low `n` limbs.
+    integer mul_high(const integer &a, const integer &b, size_t n);
+
+    /// writes the low `n` limbs of `a * b` into `out`, where `a_len <= n` and `b_len <= n`.
+    void mullo_limbs(limb_t *out, const limb_t *a, size_t a_len, const limb_t *b, size_t b_len, size_t n);
+
+    /// writes the sum of the partial products `a[i] * b[j]` where `i + j >= c` into the `a_len + b_len`
+    /// limbs of `out`, some of the partial products below `c` may also be included.
+    void mulhi_limbs(limb_t *out, const limb_t *a, size_t a_len, const limb_t *b, size_t b_len, size_t c);
+
+    /// @return returns `n / d` for a `d` that is known to divide `n`, the quotient is built from the
+    /// low limbs with the 2-adic inverse of `d` and no remainder is formed. The result is unspecified
+    /// when `d` does not divide `n`, throws `std::domain_error` when `d` is zero.
+    integer divexact(const integer &n, const integer &d);
+
+    /// @return returns the inverse of an odd limb `d` modulo `B`.
+    limb_t binvert_limb(limb_t d);
+
+    /// @return returns `n mod m` from one pass over the limbs of `n` without a quotient, throws
+    /// `std::domain_error` when `m` is zero.
+    limb_t mod_small(const integer &n, limb_t m);
+
+    /// `residues[i] = n mod moduli[i]` for `count` moduli, the moduli that divide `2^(3/4 * BASE_BITS) - 1`
+    /// are read from one folded residue and the others share a pass while their product fits in a
+    /// limb. Throws `std::domain_error` when a modulus is zero.
+    void mod_small(limb_t *residues, const integer &n, const limb_t *moduli, size_t count);
+
+    /// @return returns true if `d` divides `n`, an odd `d` (after its factors of two) is tested with its
+    /// inverse modulo `B` and no remainder is formed. Throws `std::domain_error` when `d` is zero.
+    bool divisible(const integer &n, limb_t d);
+
+    /// `acc += a * b`, the partial products are added straight into `acc` without a product buffer
+    /// while the shorter operand is below `KARATSUBA_SIZE`.
+    void addmul(integer &acc, const integer &a, const integer &b);
+
+    /// `acc = |acc - a * b|`, @return true if `a * b` was greater than `acc`.
+    bool submul(integer &acc, const integer &a, const integer &b);
+
+    /// `acc += a * b` for a single limb `b`.
+    void addmul_1(integer &acc, const integer &a, limb_t b);
+
+    /// `acc = |acc - a * b|` for a single limb `b`, @return true if `a * b` was greater than `acc`.
+    bool submul_1(integer &acc, const integer &a, limb_t b);
+
+    /// sets the number of threads the multiplication kernels may use, `1` (the default) keeps them
+    /// sequential, should not be called while a multiplication is running.
+    void set_threads(size_t threads);
+    size_t get_threads() noexcept;
+
+    /// sets the smallest sub-product in limbs that still runs as its own task, `PARALLEL_SIZE` by default.
+    void set_parallel_size(size_t limbs);
+    size_t get_parallel_size() noexcept;
+
+    /// runs `work[0]` on the calling thread and the rest on the thread pool, @return after all of
+    /// them finished.
+    void parallel_run(std::function<void()> *work, size_t count);
+
     // IO Operators
     std::ostream &operator<<(std::ostream &out, const integer &num);
     std::istream &operator>>(std::istream &in, integer &num);
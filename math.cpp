@@ -18,15 +18,22 @@ namespace apa {
 
     template <class T>
     T factorial_template(size_t n) {
-        T factorial(1);
-        T iter = factorial;
-
-        for (size_t i = 1; i <= n; ++i) {
-            factorial *= iter;
-            iter++;
+        // consecutive factors are packed into one limb, the packed limbs are multiplied in a tree.
+        std::vector<T> factors;
+        limb_t packed = 1;
+        for (size_t i = 2; i <= n; ++i) {
+            if (i > BASE_MAX) {
+                factors.push_back(T(i));
+            } else if ((cast_t) packed * i > BASE_MAX) {
+                factors.push_back(T(packed));
+                packed = i;
+            } else {
+                packed *= i;
+            }
         }
+        factors.push_back(T(packed));
 
-        return factorial;
+        return product_tree(factors, 0, factors.size(), get_threads());
     }
 
     integer fibonacci_integer(size_t nth, integer b0, integer b1) {
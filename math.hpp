@@ -11,6 +11,59 @@ namespace apa {
     integer factorial_integer(size_t n);
     bint factorial(size_t n);
 
+    /// multiplies `factors[low, high)` pairwise in a balanced tree so both operands of a product have
+    /// about the same size, the factors are consumed. The two subtrees of the top levels run in
+    /// parallel while `tasks` allows more than one.
+    template <class T>
+    T product_tree(std::vector<T> &factors, size_t low, size_t high, size_t tasks) {
+        if (high - low == 1) {
+            return std::move(factors[low]);
+        } else if (high - low == 2) {
+            return factors[low] * factors[low + 1];
+        }
+
+        size_t mid = low + (high - low) / 2;
+        T left, right;
+        if (tasks > 1) {
+            std::function<void()> work[2] = {
+                [&] { left = product_tree(factors, low, mid, tasks / 2); },
+                [&] { right = product_tree(factors, mid, high, tasks - tasks / 2); }
+            };
+            parallel_run(work, 2);
+        } else {
+            left = product_tree(factors, low, mid, 1);
+            right = product_tree(factors, mid, high, 1);
+        }
+        return left * right;
+    }
+
+    template <class T, class Iterator>
+    T product_template(Iterator first, Iterator last) {
+        std::vector<T> factors;
+        for (; first != last; ++first) {
+            factors.push_back(T(*first));
+        }
+
+        if (factors.empty()) {
+            return T(1);
+        }
+        return product_tree(factors, 0, factors.size(), get_threads());
+    }
+
+    /// @return the product of every value in `[first, last)`, the values can be `integer` or
+    /// non-negative machine integers, an empty range is 1.
+    template <class Iterator>
+    integer product_integer(Iterator first, Iterator last) {
+        return product_template<integer>(first, last);
+    }
+
+    /// @return the product of every value in `[first, last)`, the values can be `bint` or machine
+    /// integers, an empty range is 1.
+    template <class Iterator>
+    bint product(Iterator first, Iterator last) {
+        return product_template<bint>(first, last);
+    }
+
 } // namespace apa
 
 #endif
\ No newline at end of file
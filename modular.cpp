@@ -0,0 +1,330 @@
+#ifndef APA_MODULAR_CPP
+#define APA_MODULAR_CPP
+
+#include "modular.hpp"
+
+namespace apa {
+
+    /// @return returns a scratch buffer of at least `len` limbs owned by the calling thread.
+    static limb_t *thread_scratch(size_t len) {
+        static thread_local std::vector<limb_t> scratch;
+        if (scratch.size() < len) {
+            scratch.resize(len);
+        }
+        return scratch.data();
+    }
+
+    // Barrett Reduction
+    // - for `x < B^2k`, `q = floor(floor(x / B^(k - 1)) * mu / B^(k + 1))` is at most two below
+    //   `floor(x / m)`. The partial products of `floor(x / B^(k - 1)) * mu` below a few guard limbs
+    //   under `B^(k + 1)` are skipped, which costs at most one more, so `x - q * m` is below `4m` and
+    //   fits in `k + 1` limbs. Only the low `k + 1` limbs of `q * m` are ever formed.
+    // - both short products run on the raw limbs of a per-thread scratch buffer, `2k + 3` limbs for
+    //   the quotient estimate and `q * m`, then `2k` limbs for the product of `mulmod` and `sqrmod`.
+
+    barrett_context::barrett_context(const bint &m) : modulus(m), mu(0), k(m.number.length) {
+        if (!m) {
+            throw std::domain_error("barrett_context - barrett_context : division by zero");
+        }
+        modulus.sign = POSITIVE;
+
+        integer power(2 * k + 1 + LIMB_GROWTH, 2 * k + 1), q(0);
+        std::memset(power.limbs, 0x00, 2 * k * LIMB_BYTES);
+        power.limbs[2 * k] = 1;
+        integer::div_mod(q, mu, power, modulus.number);
+        mu = std::move(q);
+    }
+
+    const bint &barrett_context::modulus_view() const noexcept {
+        return modulus;
+    }
+
+    integer barrett_context::reduce_limbs(const limb_t *x, size_t len) const {
+        while (len > 1 && !x[len - 1]) {
+            --len;
+        }
+
+        integer r(k + 1 + LIMB_GROWTH, k + 1);
+        std::memset(r.limbs, 0x00, (k + 1) * LIMB_BYTES);
+        std::memcpy(r.limbs, x, std::min(len, k + 1) * LIMB_BYTES);
+
+        if (len >= k) {
+            // the skipped partial products sum below `min_len * B^(c + 2)`, with
+            // `B^(guard - 2) >= 2 * min_len` they move `q` by at most one.
+            size_t high_len = len - k + 1, product_len = high_len + mu.length;
+            size_t min_len = std::min(high_len, mu.length), bits = 0;
+            for (size_t span = min_len * 2; span; span >>= 1) {
+                ++bits;
+            }
+            size_t guard = 2 + (bits + BASE_BITS_MINUS1) / BASE_BITS;
+            size_t c = k + 1 > guard ? k + 1 - guard : 0;
+
+            limb_t *product = thread_scratch(4 * k + 3);
+            mulhi_limbs(product, x + k - 1, high_len, mu.limbs, mu.length, c);
+
+            // `q` sits above limb `k`, the low `k + 1` limbs of `q * m` are written below it.
+            size_t q_len = std::min(product_len - (k + 1), k + 1);
+            mullo_limbs(product, product + k + 1, q_len, modulus.number.limbs, k, k + 1);
+
+            // `x - q * m` modulo `B^(k + 1)` is the true difference since it is below `4m`.
+            integer::sub_n(r.limbs, r.limbs, product, k + 1);
+        }
+
+        r.remove_leading_zeros();
+        while (r >= modulus.number) {
+            r -= modulus.number;
+        }
+        return r;
+    }
+
+    integer barrett_context::reduce_integer(const integer &x) const {
+        if (x.length <= 2 * k) {
+            return reduce_limbs(x.limbs, x.length);
+        }
+
+        // `r * B^step + x[pos, pos + step)` stays below `m * B^k`, one step per `k` limbs.
+        size_t pos = x.length - 2 * k;
+        integer r = reduce_limbs(x.limbs + pos, 2 * k);
+        integer window(2 * k + LIMB_GROWTH, 2 * k);
+        while (pos) {
+            size_t step = std::min(k, pos);
+            pos -= step;
+            std::memcpy(window.limbs, x.limbs + pos, step * LIMB_BYTES);
+            std::memcpy(window.limbs + step, r.limbs, r.length * LIMB_BYTES);
+            r = reduce_limbs(window.limbs, step + r.length);
+        }
+        return r;
+    }
+
+    bint barrett_context::reduce(const bint &x) const {
+        bint r(POSITIVE, reduce_integer(x.number));
+        if (x.sign && r) {
+            r.number = modulus.number - r.number;
+        }
+        return r;
+    }
+
+    bint barrett_context::mulmod(const bint &a, const bint &b) const {
+        const integer &l = a.number, &s = b.number;
+        size_t len = l.length + s.length;
+
+        bint r;
+        if (len <= 2 * k) {
+            // the product of two residues lands in the scratch limbs above the reduction, which asks
+            // for the same length so the buffer is not moved under it.
+            limb_t *product = thread_scratch(4 * k + 3) + 2 * k + 3;
+            integer::mul_limbs(product, len, 0, l.limbs, l.length, 0, s.limbs, s.length, 0);
+            r.number = reduce_limbs(product, len);
+        } else {
+            r.number = reduce_integer(l * s);
+        }
+
+        if ((a.sign ^ b.sign) && r) {
+            r.number = modulus.number - r.number;
+        }
+        return r;
+    }
+
+    bint barrett_context::sqrmod(const bint &a) const {
+        const integer &l = a.number;
+        if (2 * l.length > 2 * k) {
+            return bint(POSITIVE, reduce_integer(l.square()));
+        }
+
+        limb_t *product = thread_scratch(4 * k + 3) + 2 * k + 3;
+        integer::sqr_limbs(product, 2 * l.length, 0, l.limbs, l.length, 0);
+        return bint(POSITIVE, reduce_limbs(product, 2 * l.length));
+    }
+
+    // Montgomery Multiplication
+    // - `t + u * m` with `u = t[0] * -m^-1 mod B` has a zero lowest limb, so `t / B` is exact. `k` such
+    //   steps divide by `R` and keep `t` below `2m` when both operands are below `m`, one subtraction
+    //   brings it back under `m`.
+    // - the rows of `mont_mul` accumulate into `scratch` one limb further every step instead of
+    //   shifting it, the result is read from limb `k`.
+
+    /// @return returns; -1 : if `l < r`, 0 : if `l == r`, 1 : if `l > r`, both of `n` limbs.
+    static int compare_limbs(const limb_t *l, const limb_t *r, size_t n) {
+        for (size_t i = n; i--;) {
+            if (l[i] != r[i]) {
+                return l[i] < r[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    montgomery_context::montgomery_context(const bint &m)
+        : modulus(m), r_squared(m.number.length), inverse(0), k(m.number.length) {
+        if (!(m.number.limbs[0] & 1)) {
+            throw std::domain_error("montgomery_context - montgomery_context : even modulus");
+        }
+        modulus.sign = POSITIVE;
+        inverse = (limb_t) (0 - binvert_limb(m.number.limbs[0]));
+
+        integer power(2 * k + 1 + LIMB_GROWTH, 2 * k + 1), q(0), r(0);
+        std::memset(power.limbs, 0x00, 2 * k * LIMB_BYTES);
+        power.limbs[2 * k] = 1;
+        integer::div_mod(q, r, power, modulus.number);
+        std::memcpy(r_squared.data(), r.limbs, r.length * LIMB_BYTES);
+    }
+
+    const bint &montgomery_context::modulus_view() const noexcept {
+        return modulus;
+    }
+
+    size_t montgomery_context::limb_size() const noexcept {
+        return k;
+    }
+
+    const limb_t *montgomery_context::r_squared_view() const noexcept {
+        return r_squared.data();
+    }
+
+    void montgomery_context::mont_mul(limb_t *out, const limb_t *a, const limb_t *b, limb_t *scratch) const noexcept {
+        const limb_t *m = modulus.number.limbs;
+        std::memset(scratch, 0x00, (2 * k + 1) * LIMB_BYTES);
+
+        // `t` holds the running value below `2m` in `k + 1` limbs, the row sums need one more.
+        for (size_t i = 0; i < k; ++i) {
+            limb_t *t = scratch + i;
+            limb_t carry = integer::addmul_1(t, a, k, b[i]);
+            t[k] = (limb_t) (t[k] + carry);
+            t[k + 1] = (limb_t) (t[k + 1] + (t[k] < carry));
+
+            carry = integer::addmul_1(t, m, k, (limb_t) ((cast_t) t[0] * inverse));
+            t[k] = (limb_t) (t[k] + carry);
+            t[k + 1] = (limb_t) (t[k + 1] + (t[k] < carry));
+        }
+
+        limb_t *t = scratch + k;
+        if (t[k] || compare_limbs(t, m, k) >= 0) {
+            integer::sub_n(out, t, m, k);
+        } else {
+            std::memcpy(out, t, k * LIMB_BYTES);
+        }
+    }
+
+    void montgomery_context::mont_sqr(limb_t *out, const limb_t *a, limb_t *scratch) const noexcept {
+        integer::sqr_basecase(scratch, 2 * k, 0, a, k, 0);
+        scratch[2 * k] = 0;
+        redc(out, scratch);
+    }
+
+    void montgomery_context::redc(limb_t *out, limb_t *t) const noexcept {
+        const limb_t *m = modulus.number.limbs;
+        for (size_t i = 0; i < k; ++i) {
+            limb_t carry = integer::addmul_1(t + i, m, k, (limb_t) ((cast_t) t[i] * inverse));
+            for (size_t j = i + k; carry && j <= 2 * k; ++j) {
+                t[j] = (limb_t) (t[j] + carry);
+                carry = t[j] < carry;
+            }
+        }
+
+        t += k;
+        if (t[k] || compare_limbs(t, m, k) >= 0) {
+            integer::sub_n(out, t, m, k);
+        } else {
+            std::memcpy(out, t, k * LIMB_BYTES);
+        }
+    }
+
+    modint::modint(const montgomery_context &context, const bint &x) : context(&context), limbs(context.k) {
+        bint r = x % context.modulus;
+        if (r.sign) {
+            r += context.modulus;
+        }
+        std::memcpy(limbs.data(), r.number.limbs, r.number.length * LIMB_BYTES);
+        context.mont_mul(limbs.data(), limbs.data(), context.r_squared.data(), thread_scratch(2 * context.k + 1));
+    }
+
+    // Relational Operators
+    bool modint::operator==(const modint &op) const {
+        return limbs == op.limbs;
+    }
+
+    bool modint::operator!=(const modint &op) const {
+        return !(*this == op);
+    }
+
+    // Arithmetic Operators
+    modint &modint::operator+=(const modint &op) {
+        const limb_t *m = context->modulus.number.limbs;
+        size_t k = context->k;
+        limb_t carry = integer::add_n(limbs.data(), limbs.data(), op.limbs.data(), k);
+        if (carry || compare_limbs(limbs.data(), m, k) >= 0) {
+            integer::sub_n(limbs.data(), limbs.data(), m, k);
+        }
+        return *this;
+    }
+
+    modint &modint::operator-=(const modint &op) {
+        size_t k = context->k;
+        if (integer::sub_n(limbs.data(), limbs.data(), op.limbs.data(), k)) {
+            integer::add_n(limbs.data(), limbs.data(), context->modulus.number.limbs, k);
+        }
+        return *this;
+    }
+
+    modint &modint::operator*=(const modint &op) {
+        context->mont_mul(limbs.data(), limbs.data(), op.limbs.data(), thread_scratch(2 * context->k + 1));
+        return *this;
+    }
+
+    modint modint::operator+(const modint &op) const {
+        modint sum = *this;
+        return sum += op;
+    }
+
+    modint modint::operator-(const modint &op) const {
+        modint dif = *this;
+        return dif -= op;
+    }
+
+    modint modint::operator*(const modint &op) const {
+        modint product = *this;
+        return product *= op;
+    }
+
+    modint modint::square() const {
+        modint square = *this;
+        context->mont_sqr(square.limbs.data(), square.limbs.data(), thread_scratch(2 * context->k + 1));
+        return square;
+    }
+
+    modint modint::pow(const bint &e) const {
+        if (e < 0) {
+            throw std::domain_error("modint - pow : negative exponent");
+        }
+
+        modint result(*context, 1);
+        limb_t *scratch = thread_scratch(2 * context->k + 1);
+        const limb_t *bits = e.limb_view();
+        for (size_t i = e.bit_size(); i--;) {
+            context->mont_sqr(result.limbs.data(), result.limbs.data(), scratch);
+            if ((bits[i / LIMB_BITS] >> (i % LIMB_BITS)) & 1) {
+                context->mont_mul(result.limbs.data(), result.limbs.data(), limbs.data(), scratch);
+            }
+        }
+        return result;
+    }
+
+    bint modint::value() const {
+        size_t k = context->k;
+        limb_t *t = thread_scratch(2 * k + 1);
+        std::memcpy(t, limbs.data(), k * LIMB_BYTES);
+        std::memset(t + k, 0x00, (k + 1) * LIMB_BYTES);
+
+        integer residue(k + LIMB_GROWTH, k);
+        context->redc(residue.limbs, t);
+        residue.remove_leading_zeros();
+        return bint(POSITIVE, std::move(residue));
+    }
+
+    // IO Operators
+    std::ostream &operator<<(std::ostream &out, const modint &x) {
+        return out << x.value();
+    }
+
+} // namespace apa
+
+#endif
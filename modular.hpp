@@ -0,0 +1,128 @@
+#ifndef APA_MODULAR_HPP
+#define APA_MODULAR_HPP
+
+#include <vector>
+
+#include "bint.hpp"
+
+namespace apa {
+
+    /// a modulus prepared for many reductions (Barrett), `mu = floor(B^2k / m)` of the `k` limbs
+    /// modulus is computed once so every reduction costs two short products and at most three
+    /// subtractions instead of a division.
+    class barrett_context {
+        private:
+
+        bint modulus;
+        integer mu;
+        size_t k;
+
+        /// @return returns `x mod m` for the `len` limbs of `x`, `len <= 2k`.
+        integer reduce_limbs(const limb_t *x, size_t len) const;
+
+        /// @return returns `x mod m` of any length, the limbs above `2k` are reduced `k` at a time.
+        integer reduce_integer(const integer &x) const;
+
+        public:
+
+        /// throws `std::domain_error` when `m` is zero, the sign of `m` is ignored.
+        barrett_context(const bint &m);
+
+        const bint &modulus_view() const noexcept;
+
+        /// @return returns `x mod m` in the range `[0, m)`, also for a negative `x`. One reduction
+        /// step covers an `x` below `B^2k`, such as the product of two residues.
+        bint reduce(const bint &x) const;
+
+        /// @return returns `(a * b) mod m` in the range `[0, m)`.
+        bint mulmod(const bint &a, const bint &b) const;
+
+        /// @return returns `(a * a) mod m`, the square takes the cheaper squaring kernel.
+        bint sqrmod(const bint &a) const;
+    };
+
+    /// an odd modulus prepared for Montgomery multiplication, `R = B^k` for the `k` limbs modulus.
+    /// `-m^-1 mod B` and `R^2 mod m` are computed once, a residue `x` is kept as `x * R mod m` so a
+    /// product is reduced by adding multiples of `m` instead of dividing by it.
+    class montgomery_context {
+        private:
+
+        bint modulus;
+        std::vector<limb_t> r_squared;
+        limb_t inverse;
+        size_t k;
+
+        friend class modint;
+
+        public:
+
+        /// throws `std::domain_error` when `m` is even or zero, the sign of `m` is ignored.
+        montgomery_context(const bint &m);
+
+        const bint &modulus_view() const noexcept;
+
+        /// @return returns `k`, the number of limbs of every kernel operand.
+        size_t limb_size() const noexcept;
+
+        /// @return returns `R^2 mod m` over `k` limbs, `mont_mul(out, x, r_squared_view())` converts `x`
+        /// to Montgomery form.
+        const limb_t *r_squared_view() const noexcept;
+
+        // Montgomery Kernels
+        // - every operand and `out` have `k` limbs and are below the modulus, `scratch` holds `2k + 1`
+        //   limbs, `out` may be an operand. The kernels never allocate.
+
+        /// `out = a * b / R mod m`, every limb of `b` adds one row of `a` and one row of `m` that clears
+        /// the lowest limb (CIOS).
+        void mont_mul(limb_t *out, const limb_t *a, const limb_t *b, limb_t *scratch) const noexcept;
+
+        /// `out = a * a / R mod m`, the square is formed with its cross products once and then reduced.
+        void mont_sqr(limb_t *out, const limb_t *a, limb_t *scratch) const noexcept;
+
+        /// `out = t / R mod m` for the `2k + 1` limbs of `t` holding a value below `m * R`, `t` is
+        /// overwritten.
+        void redc(limb_t *out, limb_t *t) const noexcept;
+    };
+
+    /// a residue modulo the modulus of a `montgomery_context`, kept in Montgomery form so chained
+    /// operations never convert, `value()` converts back. The context must outlive its residues and
+    /// both operands of an operation must share the same context.
+    class modint {
+        private:
+
+        const montgomery_context *context;
+        std::vector<limb_t> limbs;
+
+        public:
+
+        /// the residue of `x` modulo the context modulus, also for a negative `x`.
+        modint(const montgomery_context &context, const bint &x);
+
+        // Relational Operators
+        bool operator==(const modint &op) const;
+        bool operator!=(const modint &op) const;
+
+        // Arithmetic Operators
+        modint &operator+=(const modint &op);
+        modint &operator-=(const modint &op);
+        modint &operator*=(const modint &op);
+        modint operator+(const modint &op) const;
+        modint operator-(const modint &op) const;
+        modint operator*(const modint &op) const;
+
+        modint square() const;
+
+        /// @return returns `*this ^ e` by left to right binary exponentiation, throws `std::domain_error`
+        /// when `e` is negative.
+        modint pow(const bint &e) const;
+
+        /// @return returns the residue in the range `[0, m)`.
+        bint value() const;
+    };
+
+    // IO Operators
+    std::ostream &operator<<(std::ostream &out, const modint &x);
+
+} // namespace apa
+
+#endif
@@ -0,0 +1,264 @@
+#ifndef APA_POLY_CPP
+#define APA_POLY_CPP
+
+#include "poly.hpp"
+
+namespace apa {
+
+    // Kronecker Substitution
+    // - a polynomial is packed into `sum coefficients[i] * 2^(i * slot_bits)`, the positive and the
+    //   negative coefficients go into separate integers so packing only ors bits into empty slots.
+    // - a slot holds `|c| < 2^(slot_bits - 1)` for every product coefficient `c`, a slot read
+    //   back at or above `2^(slot_bits - 1)` is a negative coefficient that borrowed from the next one.
+
+    /// ors the `len` limbs of `src` into `out` starting at bit `bit`.
+    static void pack_bits(limb_t *out, size_t bit, const limb_t *src, size_t len) {
+        limb_t *dst = out + bit / LIMB_BITS;
+        size_t shift = bit % LIMB_BITS;
+
+        if (!shift) {
+            for (size_t i = 0; i < len; ++i) {
+                dst[i] |= src[i];
+            }
+            return;
+        }
+
+        limb_t carry = 0;
+        for (size_t i = 0; i < len; ++i) {
+            dst[i] |= (limb_t) (src[i] << shift) | carry;
+            carry = src[i] >> (LIMB_BITS - shift);
+        }
+        dst[len] |= carry;
+    }
+
+    /// @return returns the `bits` bits of `src` starting at bit `bit`, bits past `len` limbs are zero.
+    static integer unpack_bits(const limb_t *src, size_t len, size_t bit, size_t bits) {
+        size_t first = bit / LIMB_BITS, shift = bit % LIMB_BITS;
+        size_t out_len = (bits + LIMB_BITS - 1) / LIMB_BITS;
+
+        integer chunk(out_len + LIMB_GROWTH, out_len);
+        for (size_t i = 0; i < out_len; ++i) {
+            limb_t low = first + i < len ? src[first + i] : 0;
+            limb_t high = first + i + 1 < len ? src[first + i + 1] : 0;
+            chunk.limbs[i] = shift ? (limb_t) ((low >> shift) | (limb_t) (high << (LIMB_BITS - shift))) : low;
+        }
+
+        if (bits % LIMB_BITS) {
+            chunk.limbs[out_len - 1] &= ((limb_t) 1 << (bits % LIMB_BITS)) - 1;
+        }
+
+        chunk.remove_leading_zeros();
+        return chunk;
+    }
+
+    /// @return returns the bit size of the largest coefficient.
+    static size_t coefficient_bits(const std::vector<bint> &coefficients) {
+        size_t bits = 0;
+        for (size_t i = 0; i < coefficients.size(); ++i) {
+            bits = std::max(bits, coefficients[i].bit_size());
+        }
+        return bits;
+    }
+
+    bint kronecker_pack(const std::vector<bint> &coefficients, size_t slot_bits) {
+        size_t len = coefficients.size() * slot_bits / LIMB_BITS + 2;
+        integer positive(len + LIMB_GROWTH, len), negative(len + LIMB_GROWTH, len);
+        std::memset(positive.limbs, 0x00, len * LIMB_BYTES);
+        std::memset(negative.limbs, 0x00, len * LIMB_BYTES);
+
+        bool has_negative = false;
+        for (size_t i = 0; i < coefficients.size(); ++i) {
+            const bint &c = coefficients[i];
+            if (c) {
+                has_negative |= c.sign == NEGATIVE;
+                pack_bits(c.sign ? negative.limbs : positive.limbs, i * slot_bits, c.number.limbs, c.number.length);
+            }
+        }
+
+        positive.remove_leading_zeros();
+        bint packed(POSITIVE, std::move(positive));
+        if (has_negative) {
+            negative.remove_leading_zeros();
+            packed -= bint(POSITIVE, std::move(negative));
+        }
+        return packed;
+    }
+
+    std::vector<bint> kronecker_unpack(const bint &packed, size_t count, size_t slot_bits) {
+        std::vector<bint> coefficients(count);
+        bint half = bint(1) << (slot_bits - 1), full = bint(1) << slot_bits;
+
+        bool borrow = false;
+        for (size_t i = 0; i < count; ++i) {
+            bint c(POSITIVE, unpack_bits(packed.number.limbs, packed.number.length, i * slot_bits, slot_bits));
+            if (borrow) {
+                ++c;
+            }
+
+            borrow = c >= half;
+            if (borrow) {
+                c -= full;
+            }
+
+            if (!c) {
+                c.sign = POSITIVE;
+            } else if (packed.sign) {
+                c.sign ^= 1u;
+            }
+            coefficients[i] = std::move(c);
+        }
+        return coefficients;
+    }
+
+    // Constructors
+    poly::poly() {
+    }
+
+    poly::poly(std::initializer_list<bint> coefficients) : coefficients(coefficients) {
+        trim();
+    }
+
+    poly::poly(const std::vector<bint> &coefficients) : coefficients(coefficients) {
+        trim();
+    }
+
+    poly::poly(std::vector<bint> &&coefficients) : coefficients(std::move(coefficients)) {
+        trim();
+    }
+
+    void poly::trim() {
+        while (!coefficients.empty() && !coefficients.back()) {
+            coefficients.pop_back();
+        }
+    }
+
+    // Index Operator
+    const bint &poly::operator[](size_t i) const {
+        return i < coefficients.size() ? coefficients[i] : __BINT_ZERO;
+    }
+
+    // Relational Operators
+    bool poly::operator==(const poly &op) const {
+        return coefficients == op.coefficients;
+    }
+
+    bool poly::operator!=(const poly &op) const {
+        return !(*this == op);
+    }
+
+    // Arithmetic Operators
+    poly &poly::operator+=(const poly &op) {
+        if (coefficients.size() < op.coefficients.size()) {
+            coefficients.resize(op.coefficients.size(), __BINT_ZERO);
+        }
+        for (size_t i = 0; i < op.coefficients.size(); ++i) {
+            coefficients[i] += op.coefficients[i];
+        }
+        trim();
+        return *this;
+    }
+
+    poly &poly::operator-=(const poly &op) {
+        if (coefficients.size() < op.coefficients.size()) {
+            coefficients.resize(op.coefficients.size(), __BINT_ZERO);
+        }
+        for (size_t i = 0; i < op.coefficients.size(); ++i) {
+            coefficients[i] -= op.coefficients[i];
+        }
+        trim();
+        return *this;
+    }
+
+    poly &poly::operator*=(const poly &op) {
+        poly product = *this * op;
+        std::swap(coefficients, product.coefficients);
+        return *this;
+    }
+
+    poly poly::operator+(const poly &op) const {
+        poly sum = *this;
+        return sum += op;
+    }
+
+    poly poly::operator-(const poly &op) const {
+        poly dif = *this;
+        return dif -= op;
+    }
+
+    poly poly::operator*(const poly &op) const {
+        if (coefficients.empty() || op.coefficients.empty()) {
+            return poly();
+        }
+
+        if (std::min(coefficients.size(), op.coefficients.size()) < KRONECKER_SIZE) {
+            return mul_naive(op);
+        }
+
+        // a product coefficient sums at most `terms` products of `l_bits + r_bits` bits, one more
+        // bit keeps its sign.
+        size_t terms = std::min(coefficients.size(), op.coefficients.size());
+        size_t slot_bits = coefficient_bits(coefficients) + coefficient_bits(op.coefficients) + 1;
+        for (; terms; terms >>= 1) {
+            ++slot_bits;
+        }
+
+        bint packed = kronecker_pack(coefficients, slot_bits), product;
+        if (this == &op) {
+            product = packed.square();
+        } else {
+            product = packed * kronecker_pack(op.coefficients, slot_bits);
+        }
+
+        size_t count = coefficients.size() + op.coefficients.size() - 1;
+        return poly(kronecker_unpack(product, count, slot_bits));
+    }
+
+    poly poly::operator-() const {
+        poly negate = *this;
+        for (size_t i = 0; i < negate.coefficients.size(); ++i) {
+            if (negate.coefficients[i]) {
+                negate.coefficients[i] = -negate.coefficients[i];
+            }
+        }
+        return negate;
+    }
+
+    poly poly::mul_naive(const poly &op) const {
+        if (coefficients.empty() || op.coefficients.empty()) {
+            return poly();
+        }
+
+        std::vector<bint> product(coefficients.size() + op.coefficients.size() - 1, __BINT_ZERO);
+        for (size_t i = 0; i < coefficients.size(); ++i) {
+            for (size_t j = 0; j < op.coefficients.size(); ++j) {
+                addmul(product[i + j], coefficients[i], op.coefficients[j]);
+            }
+        }
+        return poly(std::move(product));
+    }
+
+    // Methods
+    size_t poly::size() const noexcept {
+        return coefficients.size();
+    }
+
+    size_t poly::degree() const noexcept {
+        return coefficients.empty() ? 0 : coefficients.size() - 1;
+    }
+
+    const std::vector<bint> &poly::coefficient_view() const noexcept {
+        return coefficients;
+    }
+
+    // IO Operators
+    std::ostream &operator<<(std::ostream &out, const poly &p) {
+        out << "{";
+        for (size_t i = 0; i < p.size(); ++i) {
+            out << (i ? ", " : "") << p[i];
+        }
+        return out << "}";
+    }
+
+} // namespace apa
+
+#endif
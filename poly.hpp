@@ -0,0 +1,76 @@
+#ifndef APA_POLY_HPP
+#define APA_POLY_HPP
+
+#include <vector>
+
+#include "bint.hpp"
+
+namespace apa {
+
+    /// polynomial with `bint` coefficients, `coefficients[i]` belongs to `x^i` and the highest
+    /// coefficient is never zero, the zero polynomial has no coefficients.
+    class poly {
+        private:
+
+        std::vector<bint> coefficients;
+
+        /// drops the zero coefficients of the highest powers.
+        void trim();
+
+        public:
+
+        // Constructors
+        poly();
+        poly(std::initializer_list<bint> coefficients);
+        poly(const std::vector<bint> &coefficients);
+        poly(std::vector<bint> &&coefficients);
+
+        // Index Operator
+        /// @return returns the coefficient of `x^i`, zero past the degree.
+        const bint &operator[](size_t i) const;
+
+        // Relational Operators
+        bool operator==(const poly &op) const;
+        bool operator!=(const poly &op) const;
+
+        // Arithmetic Operators
+        poly &operator+=(const poly &op);
+        poly &operator-=(const poly &op);
+        poly &operator*=(const poly &op);
+        poly operator+(const poly &op) const;
+        poly operator-(const poly &op) const;
+
+        /// Kronecker substitution, both polynomials are evaluated at a power of two wide enough to
+        /// keep every product coefficient apart, multiplied as one integer and the product is read
+        /// back slot by slot. Below `KRONECKER_SIZE` coefficients it falls back to `mul_naive`.
+        poly operator*(const poly &op) const;
+
+        poly operator-() const;
+
+        /// @return returns the product computed coefficient by coefficient.
+        poly mul_naive(const poly &op) const;
+
+        // Methods
+        /// @return returns the number of coefficients, 0 for the zero polynomial.
+        size_t size() const noexcept;
+
+        /// @return returns the highest power with a non zero coefficient, 0 for the zero polynomial.
+        size_t degree() const noexcept;
+
+        const std::vector<bint> &coefficient_view() const noexcept;
+    };
+
+    /// @return returns `sum coefficients[i] * 2^(i * slot_bits)`, where every coefficient has less than
+    /// `slot_bits` bits.
+    bint kronecker_pack(const std::vector<bint> &coefficients, size_t slot_bits);
+
+    /// @return returns the `count` coefficients of `packed`, where every coefficient is in the open
+    /// range `(-2^(slot_bits - 1), 2^(slot_bits - 1))`.
+    std::vector<bint> kronecker_unpack(const bint &packed, size_t count, size_t slot_bits);
+
+    // IO Operators
+    std::ostream &operator<<(std::ostream &out, const poly &p);
+
+} // namespace apa
+
+#endif
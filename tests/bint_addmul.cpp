@@ -0,0 +1,78 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return true if `addmul` and `submul` on a copy of `acc` match `acc + a * b` and `acc - a * b`.
+bool fused_matches(const apa::bint &acc, const apa::bint &a, const apa::bint &b) {
+    apa::bint sum = acc, dif = acc;
+    apa::addmul(sum, a, b);
+    apa::submul(dif, a, b);
+    return sum == acc + a * b && dif == acc - a * b;
+}
+
+/// @return true if `addmul_1` and `submul_1` on a copy of `acc` match `acc + a * b` and `acc - a * b`.
+bool fused_1_matches(const apa::bint &acc, const apa::bint &a, apa::limb_t b) {
+    apa::bint sum = acc, dif = acc, limb = apa::bint(apa::POSITIVE, apa::integer(b));
+    apa::addmul_1(sum, a, b);
+    apa::submul_1(dif, a, b);
+    return sum == acc + a * limb && dif == acc - a * limb;
+}
+
+int main() {
+    START_TEST;
+
+    apa::bint zero = 0, small = 0xffff, fac20 = apa::factorial(20) * apa::factorial(20) * 3,
+              fac100 = apa::factorial(100), fac1200 = apa::factorial(1200), fib9000 = apa::fibonacci(9000);
+
+    // all limbs saturated, every row carries into the next one.
+    apa::bint ones = (apa::bint(1) << (apa::LIMB_BITS * 40)) - 1;
+
+    ASSERT_EXPRESSION(fused_matches(zero, fac100, fac1200), "fused 0 +- fac100 * fac1200                ");
+    ASSERT_EXPRESSION(fused_matches(fac1200, zero, fac100), "fused fac1200 +- 0 * fac100                ");
+    ASSERT_EXPRESSION(fused_matches(small, small, small), "fused 0xffff +- 0xffff * 0xffff            ");
+    ASSERT_EXPRESSION(fused_matches(fac1200, fac20, fib9000), "fused fac1200 +- fac20 * fib9000           ");
+    ASSERT_EXPRESSION(fused_matches(fib9000, fac1200, fac20), "fused fib9000 +- fac1200 * fac20           ");
+    ASSERT_EXPRESSION(fused_matches(fac100, fac1200, fib9000), "fused fac100 +- fac1200 * fib9000          ");
+    ASSERT_EXPRESSION(fused_matches(-fac1200, fac20, fib9000), "fused -fac1200 +- fac20 * fib9000          ");
+    ASSERT_EXPRESSION(fused_matches(fac1200, -fac20, fib9000), "fused fac1200 +- -fac20 * fib9000          ");
+    ASSERT_EXPRESSION(fused_matches(-fac100, -fac1200, fac1200), "fused -fac100 +- -fac1200 * fac1200        ");
+    ASSERT_EXPRESSION(fused_matches(ones, ones, small), "fused ones +- ones * 0xffff                ");
+    ASSERT_EXPRESSION(fused_matches(-ones, ones, ones), "fused -ones +- ones * ones                 ");
+    ASSERT_EXPRESSION(fused_matches(fac20 * fib9000, fac20, fib9000), "fused fac20 * fib9000 +- fac20 * fib9000   ");
+    ASSERT_EXPRESSION(fused_1_matches(fac1200, fib9000, 0), "fused_1 fac1200 +- fib9000 * 0             ");
+    ASSERT_EXPRESSION(fused_1_matches(fac1200, fib9000, 7), "fused_1 fac1200 +- fib9000 * 7             ");
+    ASSERT_EXPRESSION(fused_1_matches(-fac1200, fac100, apa::BASE_MAX), "fused_1 -fac1200 +- fac100 * BASE_MAX      ");
+    ASSERT_EXPRESSION(fused_1_matches(small, -ones, apa::BASE_MAX), "fused_1 0xffff +- -ones * BASE_MAX         ");
+
+    // `acc` sharing its limbs with an operand.
+    apa::bint x = fac1200, y = fac20;
+    apa::addmul(x, x, fib9000);
+    apa::submul(y, fac100, y);
+    apa::addmul(small, small, small);
+    ASSERT_EQUALITY(x, fac1200 + fac1200 * fib9000, "addmul(x, x, fib9000)                      ");
+    ASSERT_EQUALITY(y, fac20 - fac100 * fac20, "submul(y, fac100, y)                       ");
+    ASSERT_EQUALITY(small, apa::bint(0xffff) + apa::bint(0xffff) * apa::bint(0xffff), "addmul(s, s, s)                            ");
+
+    // dot product, the accumulator crosses zero on the way.
+    apa::bint dot = 0, expected = 0;
+    apa::bint terms[4] = {fac1200, -fib9000, fac100, -fac1200};
+    for (size_t i = 0; i < 4; ++i) {
+        apa::addmul(dot, terms[i], terms[3 - i]);
+        expected += terms[i] * terms[3 - i];
+    }
+    ASSERT_EQUALITY(dot, expected, "dot product                                ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 FUSED MULTIPLY-ADD");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 FUSED MULTIPLY-ADD");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 FUSED MULTIPLY-ADD");
+#endif
+}
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <thread>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+    #include <modular.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return returns `x mod m` in the range `[0, m)`.
+apa::bint mod(const apa::bint &x, const apa::bint &m) {
+    apa::bint r = x % m;
+    return r < 0 ? r + m : r;
+}
+
+int main() {
+    START_TEST;
+
+    apa::bint fib500 = apa::fibonacci(500), f200 = apa::factorial(200), f400 = apa::factorial(400);
+    apa::bint prime = (apa::bint(1) << 127) - 1, power = apa::bint(1) << (apa::LIMB_BITS * 4);
+
+    apa::barrett_context mersenne(prime), fibonacci(fib500), powered(-power), one(1);
+    ASSERT_EQUALITY(mersenne.modulus_view(), prime, "modulus_view()                       ");
+    ASSERT_EQUALITY(powered.modulus_view(), power, "modulus_view() of a negative modulus ");
+
+    apa::bint a = f200 % prime, b = fib500 % prime;
+    ASSERT_EQUALITY(mersenne.mulmod(a, b), (a * b) % prime, "mulmod (2^127 - 1)                   ");
+    ASSERT_EQUALITY(mersenne.sqrmod(a), (a * a) % prime, "sqrmod (2^127 - 1)                   ");
+    ASSERT_EQUALITY(mersenne.reduce(f400), f400 % prime, "reduce 400! mod (2^127 - 1)          ");
+    ASSERT_EQUALITY(mersenne.reduce(-f200), mod(-f200, prime), "reduce -200! mod (2^127 - 1)         ");
+    ASSERT_EQUALITY(mersenne.mulmod(-a, b), mod(-a * b, prime), "mulmod -a * b                        ");
+
+    ASSERT_EQUALITY(fibonacci.reduce(f400), f400 % fib500, "reduce 400! mod fib(500)             ");
+    ASSERT_EQUALITY(fibonacci.mulmod(f200, f400), (f200 * f400) % fib500, "mulmod 200! * 400! mod fib(500)      ");
+    ASSERT_EQUALITY(fibonacci.sqrmod(f200 - 1), mod((f200 - 1).square(), fib500), "sqrmod (200! - 1) mod fib(500)       ");
+    ASSERT_EQUALITY(fibonacci.reduce(fib500 * 3), 0, "reduce 3 * fib(500) mod fib(500)     ");
+    ASSERT_EQUALITY(fibonacci.reduce(fib500 - 1), fib500 - 1, "reduce fib(500) - 1 mod fib(500)     ");
+
+    ASSERT_EQUALITY(powered.reduce(f400), f400 % power, "reduce 400! mod B^4                  ");
+    ASSERT_EQUALITY(powered.mulmod(power - 1, power - 1), 1, "mulmod (B^4 - 1)^2 mod B^4           ");
+    ASSERT_EQUALITY(one.mulmod(f200, f400), 0, "mulmod 200! * 400! mod 1             ");
+    ASSERT_EQUALITY(one.reduce(-f200).to_base10_string(), "0", "reduce -200! mod 1                   ");
+
+    // chained products against a modulus large enough for the blocked short products.
+    apa::bint big = apa::fibonacci(20000) + 2, x = f400, y = f400, z = f400;
+    apa::barrett_context large(big);
+    for (size_t i = 0; i < 12; ++i) {
+        x = large.mulmod(x, z);
+        y = (y * z) % big;
+        z = large.sqrmod(z + i);
+    }
+    ASSERT_EQUALITY(x, y, "chained mulmod mod fib(20000) + 2    ");
+
+    // two threads sharing one context each keep their own scratch limbs.
+    apa::bint left = f200, right = f400 % big;
+    std::thread worker([&]() {
+        for (size_t i = 0; i < 50; ++i) {
+            left = large.mulmod(left, z);
+        }
+    });
+    for (size_t i = 0; i < 50; ++i) {
+        right = large.sqrmod(right);
+    }
+    worker.join();
+    apa::bint left_check = f200, right_check = f400 % big;
+    for (size_t i = 0; i < 50; ++i) {
+        left_check = (left_check * z) % big;
+        right_check = (right_check * right_check) % big;
+    }
+    ASSERT_EQUALITY(left, left_check, "mulmod from a second thread          ");
+    ASSERT_EQUALITY(right, right_check, "sqrmod beside a second thread        ");
+
+    bool throws = false;
+    try {
+        apa::barrett_context zero(0);
+    } catch (const std::domain_error &e) {
+        throws = true;
+    }
+    ASSERT_EQUALITY(throws, true, "barrett_context(0) throws            ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 BARRETT REDUCTION");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 BARRETT REDUCTION");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 BARRETT REDUCTION");
+#endif
+}
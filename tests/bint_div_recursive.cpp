@@ -0,0 +1,59 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return true if `q * d + r == n` and `|r| < |d|` where `r` has the sign of `n`.
+bool division_holds(const apa::bint &n, const apa::bint &d) {
+    apa::bint q = n / d, r = n % d;
+    bool sign_ok = !r || ((r < 0) == (n < 0));
+    apa::bint abs_r = r < 0 ? -r : r, abs_d = d < 0 ? -d : d;
+    return q * d + r == n && abs_r < abs_d && sign_ok;
+}
+
+int main() {
+    START_TEST;
+
+    // operands wide enough for several levels of the recursion in every base.
+    apa::bint f1000 = apa::factorial(1000), f700 = apa::factorial(700), f420 = apa::factorial(420);
+    apa::bint fib9000 = apa::fibonacci(9000), fib4000 = apa::fibonacci(4000);
+
+    ASSERT_EQUALITY(division_holds(f1000, f700), true, "1000! / 700!                               ");
+    ASSERT_EQUALITY(division_holds(f1000, f420), true, "1000! / 420!                               ");
+    ASSERT_EQUALITY(division_holds(fib9000, fib4000), true, "fib(9000) / fib(4000)                      ");
+    ASSERT_EQUALITY(division_holds(fib9000, f420), true, "fib(9000) / 420!                           ");
+    ASSERT_EQUALITY(division_holds(f1000 * fib9000, fib4000), true, "1000! * fib(9000) / fib(4000)              ");
+
+    // exact quotients.
+    ASSERT_EQUALITY(f1000 / f700 * f700, f1000, "(1000! / 700!) * 700!                      ");
+    ASSERT_EQUALITY(f1000 % f420, 0, "1000! % 420!                               ");
+    ASSERT_EQUALITY((fib9000 * fib4000) / fib4000, fib9000, "fib(9000) * fib(4000) / fib(4000)          ");
+    ASSERT_EQUALITY((fib9000 * fib4000 - 1) % fib4000, fib4000 - 1, "(fib(9000) * fib(4000) - 1) % fib(4000)    ");
+
+    // every limb of the divisor at its maximum, the quotient limb estimates saturate.
+    apa::bint max = (apa::bint(1) << (apa::LIMB_BITS * 120)) - 1, max_square = max * max;
+    ASSERT_EQUALITY(max_square / max, max, "max^2 / max                                ");
+    ASSERT_EQUALITY((max_square - 1) / max, max - 1, "(max^2 - 1) / max                          ");
+    ASSERT_EQUALITY((max_square - 1) % max, max - 1, "(max^2 - 1) % max                          ");
+    ASSERT_EQUALITY(division_holds(max_square + max, max - 1), true, "(max^2 + max) / (max - 1)                  ");
+
+    // signs follow the truncated division of `operator/`.
+    ASSERT_EQUALITY(division_holds(-fib9000, f420), true, "-fib(9000) / 420!                          ");
+    ASSERT_EQUALITY(division_holds(fib9000, -f420), true, "fib(9000) / -420!                          ");
+    ASSERT_EQUALITY(division_holds(-fib9000, -f420), true, "-fib(9000) / -420!                         ");
+    ASSERT_EQUALITY((-f1000) / f700, -(f1000 / f700), "-1000! / 700!                              ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 RECURSIVE DIVISION");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 RECURSIVE DIVISION");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 RECURSIVE DIVISION");
+#endif
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+typedef void (*div_qr_t)(apa::bint &, apa::bint &, const apa::bint &, const apa::bint &);
+
+/// @return returns "q r" of one rounding mode as decimal strings.
+std::string qr(div_qr_t div_qr, const apa::bint &n, const apa::bint &d) {
+    apa::bint q, r;
+    div_qr(q, r, n, d);
+    return q.to_base10_string() + " " + r.to_base10_string();
+}
+
+int main() {
+    START_TEST;
+
+    // the four sign combinations of 9 and 4.
+    ASSERT_EQUALITY(qr(apa::tdiv_qr, 9, 4), "2 1", "tdiv_qr(9, 4)                       ");
+    ASSERT_EQUALITY(qr(apa::tdiv_qr, -9, 4), "-2 -1", "tdiv_qr(-9, 4)                      ");
+    ASSERT_EQUALITY(qr(apa::tdiv_qr, 9, -4), "-2 1", "tdiv_qr(9, -4)                      ");
+    ASSERT_EQUALITY(qr(apa::tdiv_qr, -9, -4), "2 -1", "tdiv_qr(-9, -4)                     ");
+
+    ASSERT_EQUALITY(qr(apa::fdiv_qr, 9, 4), "2 1", "fdiv_qr(9, 4)                       ");
+    ASSERT_EQUALITY(qr(apa::fdiv_qr, -9, 4), "-3 3", "fdiv_qr(-9, 4)                      ");
+    ASSERT_EQUALITY(qr(apa::fdiv_qr, 9, -4), "-3 -3", "fdiv_qr(9, -4)                      ");
+    ASSERT_EQUALITY(qr(apa::fdiv_qr, -9, -4), "2 -1", "fdiv_qr(-9, -4)                     ");
+
+    ASSERT_EQUALITY(qr(apa::cdiv_qr, 9, 4), "3 -3", "cdiv_qr(9, 4)                       ");
+    ASSERT_EQUALITY(qr(apa::cdiv_qr, -9, 4), "-2 -1", "cdiv_qr(-9, 4)                      ");
+    ASSERT_EQUALITY(qr(apa::cdiv_qr, 9, -4), "-2 1", "cdiv_qr(9, -4)                      ");
+    ASSERT_EQUALITY(qr(apa::cdiv_qr, -9, -4), "3 3", "cdiv_qr(-9, -4)                     ");
+
+    ASSERT_EQUALITY(qr(apa::ediv_qr, 9, 4), "2 1", "ediv_qr(9, 4)                       ");
+    ASSERT_EQUALITY(qr(apa::ediv_qr, -9, 4), "-3 3", "ediv_qr(-9, 4)                      ");
+    ASSERT_EQUALITY(qr(apa::ediv_qr, 9, -4), "-2 1", "ediv_qr(9, -4)                      ");
+    ASSERT_EQUALITY(qr(apa::ediv_qr, -9, -4), "3 3", "ediv_qr(-9, -4)                     ");
+
+    // exact divisions and a dividend below the divisor.
+    ASSERT_EQUALITY(qr(apa::fdiv_qr, -8, 4), "-2 0", "fdiv_qr(-8, 4)                      ");
+    ASSERT_EQUALITY(qr(apa::cdiv_qr, 8, -4), "-2 0", "cdiv_qr(8, -4)                      ");
+    ASSERT_EQUALITY(qr(apa::fdiv_qr, -3, 4), "-1 1", "fdiv_qr(-3, 4)                      ");
+    ASSERT_EQUALITY(qr(apa::cdiv_qr, 3, 4), "1 -1", "cdiv_qr(3, 4)                       ");
+    ASSERT_EQUALITY(qr(apa::ediv_qr, 0, -4), "0 0", "ediv_qr(0, -4)                      ");
+
+    // multi limb operands against the truncating operators.
+    apa::bint f300 = apa::factorial(300), fib700 = apa::fibonacci(700);
+    ASSERT_EQUALITY(apa::tdiv_q(-f300, fib700), -f300 / fib700, "tdiv_q(-300!, fib(700))             ");
+    ASSERT_EQUALITY(apa::tdiv_r(-f300, fib700), -f300 % fib700, "tdiv_r(-300!, fib(700))             ");
+    ASSERT_EQUALITY(apa::fdiv_q(-f300, fib700), -f300 / fib700 - 1, "fdiv_q(-300!, fib(700))             ");
+    ASSERT_EQUALITY(apa::fdiv_r(-f300, fib700), fib700 - f300 % fib700, "fdiv_r(-300!, fib(700))             ");
+    ASSERT_EQUALITY(apa::cdiv_q(f300, fib700), f300 / fib700 + 1, "cdiv_q(300!, fib(700))              ");
+    ASSERT_EQUALITY(apa::cdiv_r(f300, fib700), f300 % fib700 - fib700, "cdiv_r(300!, fib(700))              ");
+    ASSERT_EQUALITY(apa::ediv_q(-f300, -fib700), f300 / fib700 + 1, "ediv_q(-300!, -fib(700))            ");
+    ASSERT_EQUALITY(apa::ediv_r(-f300, -fib700), fib700 - f300 % fib700, "ediv_r(-300!, -fib(700))            ");
+
+    // the outputs may be the operands.
+    apa::bint n = -f300, d = fib700;
+    apa::fdiv_qr(n, d, n, d);
+    ASSERT_EQUALITY(n, -f300 / fib700 - 1, "fdiv_qr(n, d, n, d) quotient        ");
+    ASSERT_EQUALITY(d, fib700 - f300 % fib700, "fdiv_qr(n, d, n, d) remainder       ");
+
+    bool throws = false;
+    try {
+        apa::ediv_r(f300, 0);
+    } catch (const std::domain_error &e) {
+        throws = true;
+    }
+    ASSERT_EQUALITY(throws, true, "ediv_r(300!, 0) throws              ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 ROUNDING DIVISION");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 ROUNDING DIVISION");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 ROUNDING DIVISION");
+#endif
+}
@@ -0,0 +1,48 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+int main() {
+    START_TEST;
+
+    apa::bint f1200 = apa::factorial(1200), f600 = apa::factorial(600), f30 = apa::factorial(30);
+    apa::bint fib3000 = apa::fibonacci(3000), fib1500 = apa::fibonacci(1500);
+
+    // binomial(1200, 600), the divisor and the quotient are both long enough to run from both ends.
+    apa::bint binomial = apa::divexact(f1200, f600 * f600);
+    ASSERT_EQUALITY(binomial, f1200 / (f600 * f600), "1200! / (600! * 600!)                      ");
+    ASSERT_EQUALITY(apa::divexact(f1200, f600), f1200 / f600, "1200! / 600!                               ");
+    ASSERT_EQUALITY(apa::divexact(fib3000, fib1500), fib3000 / fib1500, "fib(3000) / fib(1500)                      ");
+
+    // odd and even divisors of one and two limbs.
+    ASSERT_EQUALITY(apa::divexact(f600, apa::bint(3)), f600 / 3, "600! / 3                                   ");
+    ASSERT_EQUALITY(apa::divexact(f600, apa::bint(1024)), f600 >> 10, "600! / 1024                                ");
+    ASSERT_EQUALITY(apa::divexact(f600, f30), f600 / f30, "600! / 30!                                 ");
+    ASSERT_EQUALITY(apa::divexact(f600, f600), 1, "600! / 600!                                ");
+
+    // every divisor limb at its maximum.
+    apa::bint max = (apa::bint(1) << (apa::LIMB_BITS * 40)) - 1;
+    ASSERT_EQUALITY(apa::divexact(max * fib3000, max), fib3000, "(max * fib(3000)) / max                    ");
+    ASSERT_EQUALITY(apa::divexact(max * max, max), max, "max^2 / max                                ");
+
+    // signs and zero.
+    ASSERT_EQUALITY(apa::divexact(-f1200, f600), -(f1200 / f600), "-1200! / 600!                              ");
+    ASSERT_EQUALITY(apa::divexact(f1200, -f600), -(f1200 / f600), "1200! / -600!                              ");
+    ASSERT_EQUALITY(apa::divexact(-f1200, -f600), f1200 / f600, "-1200! / -600!                             ");
+    ASSERT_EQUALITY(apa::divexact(apa::bint(0), -f600).to_base10_string(), "0", "0 / -600!                                  ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 EXACT DIVISION");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 EXACT DIVISION");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 EXACT DIVISION");
+#endif
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+int main() {
+    START_TEST;
+
+    apa::bint f300 = apa::factorial(300), fib500 = apa::fibonacci(500), fib90 = apa::fibonacci(90);
+    apa::bint max = (apa::bint(1) << (apa::LIMB_BITS * 3)) - 1, q, r;
+
+    // single limb divisors, with and without the top bit set.
+    apa::limb_t top = (apa::limb_t) 1 << (apa::LIMB_BITS - 1);
+    apa::bint small_values[4] = {3, 10, apa::bint(top) + 1, apa::bint(apa::BASE_MAX)};
+    for (size_t i = 0; i < 4; ++i) {
+        apa::divisor d(small_values[i]);
+        apa::divmod(q, r, f300, d);
+        ASSERT_EQUALITY(q, f300 / small_values[i], "300! / one limb quotient                   ");
+        ASSERT_EQUALITY(r, f300 % small_values[i], "300! / one limb remainder                  ");
+        apa::divmod(q, r, -fib500, d);
+        ASSERT_EQUALITY(q, -fib500 / small_values[i], "-fib(500) / one limb quotient              ");
+        ASSERT_EQUALITY(r, -fib500 % small_values[i], "-fib(500) / one limb remainder             ");
+    }
+
+    // multi limb divisors, the same prepared divisor is reused for every dividend.
+    apa::bint divisors[3] = {fib90, max, f300 / fib500 + 7};
+    apa::bint dividends[4] = {f300, fib500 * fib500, -max * max, f300 - 1};
+    for (size_t i = 0; i < 3; ++i) {
+        apa::divisor d(divisors[i]);
+        for (size_t j = 0; j < 4; ++j) {
+            apa::divmod(q, r, dividends[j], d);
+            ASSERT_EQUALITY(q, dividends[j] / divisors[i], "multi limb quotient                        ");
+            ASSERT_EQUALITY(r, dividends[j] % divisors[i], "multi limb remainder                       ");
+        }
+    }
+
+    // the quotient written over the dividend.
+    // a negative divisor only contributes its magnitude.
+    apa::divisor negative(-fib90);
+    apa::divmod(q, r, -f300, negative);
+    ASSERT_EQUALITY(q, -f300 / fib90, "-300! / |-fib(90)| quotient                ");
+    ASSERT_EQUALITY(r, -f300 % fib90, "-300! / |-fib(90)| remainder               ");
+
+    apa::integer n = apa::factorial_integer(200), expected = n / apa::integer(97);
+    apa::integer remainder;
+    apa::divmod(n, remainder, n, apa::divisor(apa::integer(97)));
+    ASSERT_EQUALITY(n, expected, "in place quotient                          ");
+    ASSERT_EQUALITY(remainder, apa::__INTEGER_ZERO, "200! % 97                                  ");
+
+    bool thrown = false;
+    try {
+        apa::divisor zero(apa::bint(0));
+    } catch (const std::domain_error &e) {
+        thrown = true;
+    }
+    ASSERT_EQUALITY(thrown, true, "zero divisor                               ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 DIVISOR");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 DIVISOR");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 DIVISOR");
+#endif
+}
@@ -0,0 +1,54 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return true if `divrem_by<D>` and `mod_by<D>` agree with `operator/` and `operator%`.
+template <apa::limb_t D>
+bool matches_division(const apa::bint &n) {
+    apa::bint q = n, expected_r = n % apa::bint(D);
+    apa::limb_t r = q.divrem_by<D>();
+    apa::bint signed_r = n < 0 ? -apa::bint(r) : apa::bint(r);
+    return q == n / apa::bint(D) && signed_r == expected_r && n.mod_by<D>() == r;
+}
+
+int main() {
+    START_TEST;
+
+    apa::bint f500 = apa::factorial(500), fib700 = apa::fibonacci(700) + 1, max = (apa::bint(1) << 300) - 1;
+    const apa::limb_t TOP = (apa::limb_t) 1 << (apa::LIMB_BITS - 1);
+
+    ASSERT_EQUALITY(matches_division<3>(f500 + 1), true, "divrem_by<3>(500! + 1)                     ");
+    ASSERT_EQUALITY(matches_division<7>(-fib700), true, "divrem_by<7>(-fib(700))                    ");
+    ASSERT_EQUALITY(matches_division<10>(fib700), true, "divrem_by<10>(fib(700))                    ");
+    ASSERT_EQUALITY(matches_division<10>(-max), true, "divrem_by<10>(-(2^300 - 1))                ");
+    ASSERT_EQUALITY(matches_division<251>(max), true, "divrem_by<251>(2^300 - 1)                  ");
+    ASSERT_EQUALITY(matches_division<apa::BASE10_CHUNK>(f500 - 1), true, "divrem_by<BASE10_CHUNK>(500! - 1)          ");
+    ASSERT_EQUALITY(matches_division<apa::BASE_MAX>(max), true, "divrem_by<BASE_MAX>(2^300 - 1)             ");
+    ASSERT_EQUALITY(matches_division<TOP>(-fib700), true, "divrem_by<2^(LIMB_BITS - 1)>(-fib(700))    ");
+    ASSERT_EQUALITY(matches_division<1>(fib700), true, "divrem_by<1>(fib(700))                     ");
+
+    apa::bint small = -9, zero = 0;
+    ASSERT_EQUALITY(small.divrem_by<10>(), 9u, "divrem_by<10>(-9) remainder                ");
+    ASSERT_EQUALITY(small, 0, "divrem_by<10>(-9) quotient                 ");
+    ASSERT_EQUALITY(small.to_base10_string(), "0", "divrem_by<10>(-9) sign                     ");
+    ASSERT_EQUALITY(zero.mod_by<7>(), 0u, "mod_by<7>(0)                               ");
+
+    apa::integer hundred_digits(std::string(100, '9'), 10);
+    ASSERT_EQUALITY(hundred_digits.to_base10_string(), std::string(100, '9'), "100 nines to_base10_string                 ");
+    ASSERT_EQUALITY((hundred_digits + 1).to_base10_string(), "1" + std::string(100, '0'), "10^100 to_base10_string                    ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 DIVISION BY CONSTANTS");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 DIVISION BY CONSTANTS");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 DIVISION BY CONSTANTS");
+#endif
+}
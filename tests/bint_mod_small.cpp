@@ -0,0 +1,61 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return true if `mod_small` and `divisible` agree with the magnitude of `operator%`.
+bool matches_remainder(const apa::bint &n, apa::limb_t m) {
+    apa::bint expected_r = n % apa::bint(m);
+    if (expected_r < 0) {
+        expected_r = -expected_r;
+    }
+    return apa::bint(apa::mod_small(n, m)) == expected_r && apa::divisible(n, m) == !expected_r;
+}
+
+int main() {
+    START_TEST;
+
+    apa::bint f300 = apa::factorial(300), fib1000 = apa::fibonacci(1000), max = (apa::bint(1) << 300) - 1;
+    const apa::limb_t TOP = (apa::limb_t) 1 << (apa::LIMB_BITS - 1);
+
+    // 300! has every prime up to 300 as a factor, 300! + 1 none of them.
+    ASSERT_EQUALITY(apa::mod_small(f300, 293), 0, "300! mod 293                    ");
+    ASSERT_EQUALITY(apa::mod_small(f300 + 1, 293), 1, "(300! + 1) mod 293              ");
+    ASSERT_EQUALITY(apa::divisible(f300, 3 * 5 * 7 * 11 * 13), true, "15015 | 300!                    ");
+    ASSERT_EQUALITY(apa::divisible(f300, 1024), true, "1024 | 300!                     ");
+    ASSERT_EQUALITY(apa::divisible(f300 + 2, 4), false, "4 | 300! + 2                    ");
+    ASSERT_EQUALITY(apa::divisible(apa::bint(0), 9973), true, "9973 | 0                        ");
+
+    ASSERT_EQUALITY(matches_remainder(f300 + 1, 307), true, "(300! + 1) mod 307              ");
+    ASSERT_EQUALITY(matches_remainder(-f300, 307), true, "-300! mod 307                   ");
+    ASSERT_EQUALITY(matches_remainder(-fib1000, 9973), true, "-fib(1000) mod 9973             ");
+    ASSERT_EQUALITY(matches_remainder(fib1000, 3 * 9973), true, "fib(1000) mod 29919             ");
+    ASSERT_EQUALITY(matches_remainder(max, apa::BASE_MAX), true, "(2^300 - 1) mod BASE_MAX        ");
+    ASSERT_EQUALITY(matches_remainder(max, TOP), true, "(2^300 - 1) mod 2^(LIMB_BITS-1) ");
+    ASSERT_EQUALITY(matches_remainder(max, 255), true, "(2^300 - 1) mod 255             ");
+
+    // 3, 5, 7 and 13 divide 2^(3/4 * LIMB_BITS) - 1 in every base, 11 and 9973 do not.
+    apa::limb_t moduli[] = {3, 11, 5, 7, 9973, 13, 2, 1, 4096, apa::BASE_MAX};
+    apa::limb_t residues[10];
+    apa::mod_small(residues, fib1000, moduli, 10);
+
+    bool batch_matches = true;
+    for (size_t i = 0; i < 10; ++i) {
+        batch_matches &= residues[i] == apa::mod_small(fib1000, moduli[i]);
+    }
+    ASSERT_EQUALITY(batch_matches, true, "fib(1000) mod batch             ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 SMALL MODULI");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 SMALL MODULI");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 SMALL MODULI");
+#endif
+}
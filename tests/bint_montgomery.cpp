@@ -0,0 +1,83 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+    #include <modular.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return returns `x mod m` in the range `[0, m)`.
+apa::bint mod(const apa::bint &x, const apa::bint &m) {
+    apa::bint r = x % m;
+    return r < 0 ? r + m : r;
+}
+
+int main() {
+    START_TEST;
+
+    apa::bint f200 = apa::factorial(200), fib500 = apa::fibonacci(500), fib301 = apa::fibonacci(301);
+    apa::bint prime = (apa::bint(1) << 127) - 1, all_ones = (apa::bint(1) << (apa::LIMB_BITS * 5)) - 1;
+
+    apa::montgomery_context mersenne(prime), fibonacci(fib301), ones(-all_ones), three(3);
+    ASSERT_EQUALITY(mersenne.modulus_view(), prime, "modulus_view()                         ");
+    ASSERT_EQUALITY(ones.modulus_view(), all_ones, "modulus_view() of a negative modulus   ");
+    ASSERT_EQUALITY(ones.limb_size(), 5, "limb_size()                            ");
+
+    apa::modint a(mersenne, f200), b(mersenne, -fib500);
+    ASSERT_EQUALITY(a.value(), f200 % prime, "value() 200! mod (2^127 - 1)           ");
+    ASSERT_EQUALITY(b.value(), mod(-fib500, prime), "value() -fib(500) mod (2^127 - 1)      ");
+    ASSERT_EQUALITY((a * b).value(), mod(f200 * -fib500, prime), "a * b mod (2^127 - 1)                  ");
+    ASSERT_EQUALITY((a + b).value(), mod(f200 - fib500, prime), "a + b mod (2^127 - 1)                  ");
+    ASSERT_EQUALITY((a - b).value(), mod(f200 + fib500, prime), "a - b mod (2^127 - 1)                  ");
+    ASSERT_EQUALITY(a.square().value(), mod(f200 * f200, prime), "a^2 mod (2^127 - 1)                    ");
+
+    // fermat's little theorem, 2^127 - 1 is prime.
+    ASSERT_EQUALITY(a.pow(prime - 1).value(), 1, "a^(p - 1) mod (2^127 - 1)              ");
+    ASSERT_EQUALITY((a.pow(prime - 2) * a).value(), 1, "a^(p - 2) * a mod (2^127 - 1)          ");
+    ASSERT_EQUALITY(a.pow(0).value(), 1, "a^0 mod (2^127 - 1)                    ");
+
+    // a chain that stays in montgomery form.
+    apa::modint x(fibonacci, f200), y(fibonacci, fib500), chain = x;
+    for (size_t i = 0; i < 10; ++i) {
+        chain = chain * y + x;
+        chain -= y.square();
+    }
+    apa::bint expected = f200;
+    for (size_t i = 0; i < 10; ++i) {
+        expected = mod(expected * fib500 + f200 - fib500 * fib500, fib301);
+    }
+    ASSERT_EQUALITY(chain.value(), expected, "chained operations mod fib(301)        ");
+    ASSERT_EQUALITY((chain != x), true, "chain != x                             ");
+
+    apa::modint c(ones, all_ones - 1), d(ones, all_ones + 5);
+    ASSERT_EQUALITY((c * c).value(), 1, "(m - 1)^2 mod (B^5 - 1)                ");
+    ASSERT_EQUALITY((c + d).value(), 4, "(m - 1) + 5 mod (B^5 - 1)              ");
+    ASSERT_EQUALITY(apa::modint(three, 5).pow(1000).value(), 1, "5^1000 mod 3                           ");
+    ASSERT_EQUALITY(apa::modint(three, 0).pow(7).value().to_base10_string(), "0", "0^7 mod 3                              ");
+
+    bool even_throws = false, negative_throws = false;
+    try {
+        apa::montgomery_context even(fib500 * 2);
+    } catch (const std::domain_error &e) {
+        even_throws = true;
+    }
+    try {
+        a.pow(-1);
+    } catch (const std::domain_error &e) {
+        negative_throws = true;
+    }
+    ASSERT_EQUALITY(even_throws, true, "montgomery_context(even) throws        ");
+    ASSERT_EQUALITY(negative_throws, true, "pow(-1) throws                         ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 MONTGOMERY");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 MONTGOMERY");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 MONTGOMERY");
+#endif
+}
@@ -0,0 +1,49 @@
+#include <iostream>
+#include <vector>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+int main() {
+    START_TEST;
+
+    apa::bint fac1200 = apa::factorial(1200), fac2500 = apa::factorial(2500), fib4000 = apa::fibonacci(4000),
+              fib9000 = apa::fibonacci(9000), neg_fac1200 = -fac1200;
+
+#ifndef _BASE2_16
+    size_t len = fac2500.limb_size() + fib9000.limb_size();
+    std::vector<apa::limb_t> ntt_limbs(len, 0), karatsuba_limbs(len + 1, 0);
+    apa::integer::mul_ntt(
+        ntt_limbs.data(), len, 0, fac2500.limb_view(), fac2500.limb_size(), 0, fib9000.limb_view(),
+        fib9000.limb_size(), 0
+    );
+    apa::integer::mul_karatsuba(
+        karatsuba_limbs.data(), len, 0, fac2500.limb_view(), fac2500.limb_size(), 0, fib9000.limb_view(),
+        fib9000.limb_size(), 0
+    );
+    karatsuba_limbs.pop_back();
+
+    ASSERT_EQUALITY(ntt_limbs, karatsuba_limbs, "ntt kernel vs karatsuba kernel ");
+#endif
+
+    ASSERT_EQUALITY(fac1200.mul_naive(fac1200), (fac1200 * fac1200), "fac1200 * fac1200              ");
+    ASSERT_EQUALITY(fac1200.mul_naive(fac2500), (fac1200 * fac2500), "fac1200 * fac2500              ");
+    ASSERT_EQUALITY(fac2500.mul_naive(fib4000), (fac2500 * fib4000), "fac2500 * fib4000              ");
+    ASSERT_EQUALITY(fib4000.mul_naive(fib9000), (fib4000 * fib9000), "fib4000 * fib9000              ");
+    ASSERT_EQUALITY(fib9000.mul_naive(fac2500), (fib9000 * fac2500), "fib9000 * fac2500              ");
+    ASSERT_EQUALITY(neg_fac1200.mul_naive(fib9000), (neg_fac1200 * fib9000), "-fac1200 * fib9000             ");
+    ASSERT_EQUALITY(fib9000.mul_naive(fib9000), (fib9000 * fib9000), "fib9000 * fib9000              ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 NTT MULTIPLICATION");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 NTT MULTIPLICATION");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 NTT MULTIPLICATION");
+#endif
+}
@@ -0,0 +1,40 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+int main() {
+    START_TEST;
+
+    apa::bint fac1200 = apa::factorial(1200), fib9000 = apa::fibonacci(9000), fac3000 = apa::factorial(3000);
+    apa::bint fac1200_fib9000 = fac1200 * fib9000, fib9000_square = fib9000.square();
+    apa::bint fac3000_fac1200 = fac3000 * fac1200, fac3000_fib9000 = fac3000 * fib9000;
+
+    // every sub-product above 8 limbs runs as its own task.
+    apa::set_threads(4);
+    apa::set_parallel_size(8);
+
+    ASSERT_EQUALITY(apa::get_threads(), (size_t) 4, "get_threads()                  ");
+    ASSERT_EQUALITY(apa::get_parallel_size(), (size_t) 8, "get_parallel_size()            ");
+    ASSERT_EQUALITY((fac1200 * fib9000), fac1200_fib9000, "fac1200 * fib9000              ");
+    ASSERT_EQUALITY(fib9000.square(), fib9000_square, "fib9000.square()               ");
+    ASSERT_EQUALITY((fac3000 * fac1200), fac3000_fac1200, "fac3000 * fac1200              ");
+    ASSERT_EQUALITY((fac3000 * fib9000), fac3000_fib9000, "fac3000 * fib9000              ");
+    ASSERT_EQUALITY(fac1200.mul_naive(fib9000), fac1200_fib9000, "fac1200.mul_naive(fib9000)     ");
+
+    apa::set_threads(1);
+    ASSERT_EQUALITY((fac3000 * fib9000), fac3000_fib9000, "fac3000 * fib9000, 1 thread    ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 PARALLEL MULTIPLICATION");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 PARALLEL MULTIPLICATION");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 PARALLEL MULTIPLICATION");
+#endif
+}
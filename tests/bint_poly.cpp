@@ -0,0 +1,75 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <poly.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return a polynomial of `size` coefficients taken from the fibonacci numbers, every `sign_every`
+/// coefficient is negative and every `zero_every` coefficient is zero.
+apa::poly fibonacci_poly(size_t size, size_t first, size_t sign_every, size_t zero_every) {
+    std::vector<apa::bint> coefficients(size, 0);
+    for (size_t i = 0; i < size; ++i) {
+        if (i % zero_every != zero_every - 1) {
+            coefficients[i] = apa::fibonacci(first + i * 7);
+            if (i % sign_every == 0) {
+                coefficients[i] = -coefficients[i];
+            }
+        }
+    }
+    return apa::poly(coefficients);
+}
+
+int main() {
+    START_TEST;
+
+    apa::poly zero, one = {1}, x = {0, 1}, minus_x = {0, -1};
+    apa::poly p = {3, -2, 0, 5}, q = {-7, 0, 4};
+
+    ASSERT_EQUALITY(zero * p, zero, "0 * p                                      ");
+    ASSERT_EQUALITY(one * p, p, "1 * p                                      ");
+    ASSERT_EQUALITY(x * minus_x, apa::poly({0, 0, -1}), "x * -x                                     ");
+    ASSERT_EQUALITY(p * q, apa::poly({-21, 14, 12, -43, 0, 20}), "p * q                                      ");
+    ASSERT_EQUALITY((p * q).degree(), 5u, "degree(p * q)                              ");
+    ASSERT_EQUALITY(apa::poly({1, 2, 0, 0}).size(), 2u, "trailing zero coefficients                 ");
+    ASSERT_EQUALITY((p - p).size(), 0u, "p - p                                      ");
+    ASSERT_EQUALITY(apa::poly({1, 1}) * apa::poly({1, -1}), apa::poly({1, 0, -1}), "(1 + x) * (1 - x)                          ");
+
+    // coefficients that cancel to zero inside the product, and the all negative case.
+    ASSERT_EQUALITY(-p * q, -(p * q), "-p * q                                     ");
+    ASSERT_EQUALITY(-p * -q, p * q, "-p * -q                                    ");
+
+    apa::poly small = fibonacci_poly(60, 1, 3, 5), large = fibonacci_poly(40, 900, 2, 7),
+              mixed = fibonacci_poly(25, 10, 1, 4), wide = fibonacci_poly(3, 4000, 2, 4);
+
+    ASSERT_EQUALITY(small * small, small.mul_naive(small), "small * small                              ");
+    ASSERT_EQUALITY(small * large, small.mul_naive(large), "small * large                              ");
+    ASSERT_EQUALITY(large * mixed, large.mul_naive(mixed), "large * mixed                              ");
+    ASSERT_EQUALITY(mixed * mixed, mixed.mul_naive(mixed), "mixed * mixed                              ");
+    ASSERT_EQUALITY(wide * small, wide.mul_naive(small), "wide * small                               ");
+
+    // saturated slots, every coefficient is the largest value of its bit size.
+    apa::bint max = (apa::bint(1) << (apa::LIMB_BITS * 3)) - 1;
+    apa::poly saturated = {max, max, max, max, max}, alternating = {max, -max, max, -max, max};
+    ASSERT_EQUALITY(saturated * saturated, saturated.mul_naive(saturated), "saturated * saturated                      ");
+    ASSERT_EQUALITY(
+        alternating * saturated, alternating.mul_naive(saturated), "alternating * saturated                    "
+    );
+
+    apa::poly r = small;
+    r *= large;
+    r += large;
+    r -= small * large;
+    ASSERT_EQUALITY(r, large, "p * q + q - p * q                          ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 POLYNOMIALS");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 POLYNOMIALS");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 POLYNOMIALS");
+#endif
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <list>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+int main() {
+    START_TEST;
+
+    std::vector<apa::bint> numbers;
+    apa::bint sequential = 1;
+    for (size_t i = 0; i < 300; ++i) {
+        apa::bint number = apa::fibonacci(i * 7 + 2);
+        if (i % 3 == 0) {
+            number = -number;
+        }
+        numbers.push_back(number);
+        sequential *= number;
+    }
+
+    int machine[6] = {-3, 7, 65535, 1000000, -2, 11};
+    std::list<unsigned int> unsigned_list = {4294967295u, 65537u, 3u, 1u, 4294967291u};
+
+    apa::bint fac1200 = 1;
+    for (size_t i = 2; i <= 1200; ++i) {
+        fac1200 *= i;
+    }
+
+    ASSERT_EQUALITY(apa::product(numbers.begin(), numbers.end()), sequential, "product(fibonacci numbers)             ");
+    ASSERT_EQUALITY(apa::product(numbers.begin(), numbers.begin()), apa::__BINT_ONE, "product(empty range)                   ");
+    ASSERT_EQUALITY(apa::product(numbers.begin(), numbers.begin() + 1), numbers[0], "product(one number)                    ");
+    ASSERT_EQUALITY(apa::product(machine, machine + 6), apa::bint("30277170000000"), "product(int array)                     ");
+    ASSERT_EQUALITY(
+        apa::product_integer(unsigned_list.begin(), unsigned_list.end()),
+        apa::integer("3626832794009481763553295", 10), "product_integer(unsigned list)         "
+    );
+    ASSERT_EQUALITY(apa::factorial(1200), fac1200, "factorial(1200)                        ");
+    ASSERT_EQUALITY(apa::factorial(0), apa::__BINT_ONE, "factorial(0)                           ");
+    ASSERT_EQUALITY(apa::factorial_integer(20), apa::integer("2432902008176640000", 10), "factorial_integer(20)                  ");
+
+    // the subtrees of the top levels run on the thread pool.
+    apa::set_threads(4);
+    ASSERT_EQUALITY(apa::product(numbers.begin(), numbers.end()), sequential, "product(fibonacci numbers), 4 threads ");
+    ASSERT_EQUALITY(apa::factorial(1200), fac1200, "factorial(1200), 4 threads             ");
+    apa::set_threads(1);
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 PRODUCT TREE");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 PRODUCT TREE");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 PRODUCT TREE");
+#endif
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return true if `a * b == mul_high(a, b, n) * B^n + mul_low(a, b, n)` and both match the full product.
+bool short_products_match(const apa::bint &a, const apa::bint &b, size_t n) {
+    apa::bint full = a * b, low = apa::mul_low(a, b, n), high = apa::mul_high(a, b, n);
+    apa::bint modulus = apa::bint(1) << (n * apa::LIMB_BITS);
+    return (high << (n * apa::LIMB_BITS)) + low == full && low < modulus && high == (full >> (n * apa::LIMB_BITS));
+}
+
+int main() {
+    START_TEST;
+
+    apa::bint zero = 0, small = 0xffff, fac100 = apa::factorial(100), fac1200 = apa::factorial(1200),
+              fib9000 = apa::fibonacci(9000), neg_fac1200 = -fac1200;
+
+    // all limbs saturated, the skipped partial products of mul_high carry into the kept limbs.
+    apa::bint ones = (apa::bint(1) << (apa::LIMB_BITS * 40)) - 1;
+
+    size_t fac1200_len = fac1200.limb_size(), fib9000_len = fib9000.limb_size();
+
+    ASSERT_EQUALITY(apa::mul_low(zero, fac1200, 4), zero, "mul_low(0, fac1200, 4)                     ");
+    ASSERT_EQUALITY(apa::mul_high(fac1200, zero, 4), zero, "mul_high(fac1200, 0, 4)                    ");
+    ASSERT_EQUALITY(apa::mul_low(fac1200, fib9000, 0), zero, "mul_low(fac1200, fib9000, 0)               ");
+    ASSERT_EQUALITY(apa::mul_high(fac1200, fib9000, 0), fac1200 * fib9000, "mul_high(fac1200, fib9000, 0)              ");
+    ASSERT_EXPRESSION(short_products_match(small, small, 1), "short products 0xffff * 0xffff, n = 1      ");
+    ASSERT_EXPRESSION(short_products_match(fac100, fac100, 3), "short products fac100 * fac100, n = 3      ");
+    ASSERT_EXPRESSION(
+        short_products_match(fac1200, fac1200, fac1200_len), "short products fac1200 * fac1200, n = len  "
+    );
+    ASSERT_EXPRESSION(
+        short_products_match(fac1200, fib9000, fac1200_len / 3), "short products fac1200 * fib9000, n = 1/3  "
+    );
+    ASSERT_EXPRESSION(
+        short_products_match(fib9000, fac1200, fib9000_len), "short products fib9000 * fac1200, n = len  "
+    );
+    ASSERT_EXPRESSION(
+        short_products_match(fac1200, fib9000, fac1200_len + fib9000_len - 5),
+        "short products fac1200 * fib9000, n = L-5  "
+    );
+    ASSERT_EXPRESSION(
+        short_products_match(fac1200, fib9000, fac1200_len + fib9000_len + 1),
+        "short products fac1200 * fib9000, n = L+1  "
+    );
+    ASSERT_EXPRESSION(short_products_match(ones, ones, 40), "short products ones * ones, n = 40          ");
+    ASSERT_EXPRESSION(short_products_match(ones, fac1200, 57), "short products ones * fac1200, n = 57       ");
+    ASSERT_EQUALITY(
+        apa::mul_low(neg_fac1200, fac100, fac1200_len), -apa::mul_low(fac1200, fac100, fac1200_len),
+        "mul_low(-fac1200, fac100, len)             "
+    );
+    ASSERT_EQUALITY(
+        apa::mul_high(neg_fac1200, neg_fac1200, 20), apa::mul_high(fac1200, fac1200, 20),
+        "mul_high(-fac1200, -fac1200, 20)           "
+    );
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 SHORT PRODUCTS");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 SHORT PRODUCTS");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 SHORT PRODUCTS");
+#endif
+}
@@ -0,0 +1,44 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+int main() {
+    START_TEST;
+
+    apa::bint zero = 0, small = 0xffff, fac100 = apa::factorial(100), fac1200 = apa::factorial(1200),
+              fib9000 = apa::fibonacci(9000), neg_fac1200 = -fac1200;
+
+    // all limbs saturated, every column of the square carries.
+    apa::bint ones = (apa::bint(1) << (apa::LIMB_BITS * 40)) - 1;
+
+    apa::bint self_assign = fac1200;
+    self_assign *= self_assign;
+
+    ASSERT_EQUALITY(zero.mul_naive(zero), zero.square(), "0.square()                     ");
+    ASSERT_EQUALITY(small.mul_naive(small), small.square(), "0xffff.square()                ");
+    ASSERT_EQUALITY(fac100.mul_naive(fac100), fac100.square(), "fac100.square()                ");
+    ASSERT_EQUALITY(fac1200.mul_naive(fac1200), fac1200.square(), "fac1200.square()               ");
+    ASSERT_EQUALITY(fib9000.mul_naive(fib9000), fib9000.square(), "fib9000.square()               ");
+    ASSERT_EQUALITY(ones.mul_naive(ones), ones.square(), "(2^(40*limb) - 1).square()     ");
+    ASSERT_EQUALITY(neg_fac1200.mul_naive(neg_fac1200), neg_fac1200.square(), "-fac1200.square()              ");
+    ASSERT_EQUALITY(fac1200.mul_naive(fac1200), (fac1200 * fac1200), "fac1200 * fac1200              ");
+    ASSERT_EQUALITY(fac1200.mul_naive(fac1200), self_assign, "fac1200 *= fac1200             ");
+    ASSERT_EQUALITY(
+        fac1200.mul_naive(fac1200).mul_naive(fac1200 * fac1200), (fac1200 * fac1200).square(),
+        "(fac1200 * fac1200).square()   "
+    );
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 SQUARING");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 SQUARING");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 SQUARING");
+#endif
+}
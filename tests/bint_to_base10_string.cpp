@@ -0,0 +1,58 @@
+#include <iostream>
+#include <string>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <bint.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return returns `head` followed by `zeros` zeros and `tail`.
+std::string digits(const std::string &head, size_t zeros, const std::string &tail) {
+    return head + std::string(zeros, '0') + tail;
+}
+
+/// @return returns true when `decimal` is printed back unchanged.
+bool round_trip(const std::string &decimal) {
+    return apa::bint(decimal).to_base10_string() == decimal;
+}
+
+int main() {
+    START_TEST;
+
+    // powers of ten and their neighbours land on the split points of the recursion.
+    ASSERT_EXPRESSION(round_trip(digits("1", 19, "")), "10^19                                      ");
+    ASSERT_EXPRESSION(round_trip(std::string(19, '9')), "10^19 - 1                                  ");
+    ASSERT_EXPRESSION(round_trip(digits("1", 76, "")), "10^76                                      ");
+    ASSERT_EXPRESSION(round_trip(std::string(76, '9')), "10^76 - 1                                  ");
+    ASSERT_EXPRESSION(round_trip(digits("1", 75, "1")), "10^76 + 1                                  ");
+    ASSERT_EXPRESSION(round_trip(digits("1", 1216, "")), "10^1216                                    ");
+    ASSERT_EXPRESSION(round_trip(std::string(1216, '9')), "10^1216 - 1                                ");
+    ASSERT_EXPRESSION(round_trip(digits("1", 1215, "1")), "10^1216 + 1                                ");
+    ASSERT_EXPRESSION(round_trip("-" + std::string(2000, '9')), "-(10^2000 - 1)                             ");
+
+    // long runs of zeros inside the lower halves.
+    ASSERT_EXPRESSION(round_trip(digits(digits("1", 500, "7"), 500, "3")), "1 0^500 7 0^500 3                          ");
+    ASSERT_EXPRESSION(round_trip(digits("123456789", 3000, "")), "123456789 * 10^3000                        ");
+
+    // factorials.
+    std::string f1200 = apa::factorial(1200).to_base10_string();
+    std::string f3000 = apa::factorial(3000).to_base10_string();
+    ASSERT_EQUALITY(f1200.size(), 3176u, "1200! digits                               ");
+    ASSERT_EQUALITY(f1200.substr(0, 40), "6350789086345676712402622313586536399392", "1200! leading digits                       ");
+    ASSERT_EQUALITY(f1200.substr(2876, 10), "9600000000", "1200! trailing zeros                       ");
+    ASSERT_EQUALITY(f3000.size(), 9131u, "3000! digits                               ");
+    ASSERT_EQUALITY(f3000.substr(0, 40), "4149359603437854085556867093086612170951", "3000! leading digits                       ");
+    ASSERT_EXPRESSION(round_trip(f3000), "3000! round trip                           ");
+
+#if defined(_BASE2_16)
+    RESULT("BINT BASE 2^16 TO BASE 10 STRING");
+#elif defined(_BASE2_32)
+    RESULT("BINT BASE 2^32 TO BASE 10 STRING");
+#elif defined(_BASE2_64)
+    RESULT("BINT BASE 2^64 TO BASE 10 STRING");
+#endif
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+
+#ifndef _MAKE_LIB
+    #include "../core.hpp"
+#else
+    #include <integer.hpp>
+    #include <math.hpp>
+#endif
+
+#include "mini-test.hpp"
+
+/// @return true if `x` is `floor(B^(d.length + n) / d)`.
+bool is_reciprocal(const apa::integer &x, const apa::integer &d, size_t n) {
+    apa::integer power = apa::__INTEGER_ONE << ((d.length + n) * apa::LIMB_BITS), product = x * d;
+    return product <= power && power - product < d;
+}
+
+int main() {
+    START_TEST;
+
+    apa::integer f1500 = apa::factorial_integer(1500), f900 = apa::factorial_integer(900);
+    apa::integer f300 = apa::factorial_integer(300), f40 = apa::factorial_integer(40);
+    apa::integer max = (apa::__INTEGER_ONE << (apa::LIMB_BITS * 70)) - apa::__INTEGER_ONE;
+    apa::integer power = apa::__INTEGER_ONE << (apa::LIMB_BITS * 70);
+
+    ASSERT_EQUALITY(is_reciprocal(f900.reciprocal(3), f900, 3), true, "reciprocal(900!, 3)             ");
+    ASSERT_EQUALITY(is_reciprocal(f900.reciprocal(200), f900, 200), true, "reciprocal(900!, 200)           ");
+    ASSERT_EQUALITY(is_reciprocal(f40.reciprocal(500), f40, 500), true, "reciprocal(40!, 500)            ");
+    ASSERT_EQUALITY(is_reciprocal(max.reciprocal(150), max, 150), true, "reciprocal(B^70 - 1, 150)       ");
+    ASSERT_EQUALITY(power.reciprocal(90), apa::__INTEGER_ONE << (apa::LIMB_BITS * 91), "reciprocal(B^70, 90)            ");
+    ASSERT_EQUALITY(apa::__INTEGER_ONE.reciprocal(4), apa::__INTEGER_ONE << (apa::LIMB_BITS * 5), "reciprocal(1, 4)                ");
+
+    // one reciprocal reused by several divisions, the dividends are longer than its precision.
+    size_t n = 60;
+    apa::integer x = f300.reciprocal(n);
+    apa::integer dividends[3] = {f1500, f1500 * f900 + f40, f900 - apa::__INTEGER_ONE};
+    for (size_t i = 0; i < 3; ++i) {
+        apa::integer q, r;
+        apa::integer::div_mod(q, r, dividends[i], f300, x, n);
+        ASSERT_EQUALITY(q, dividends[i] / f300, "div_mod reciprocal quotient     ");
+        ASSERT_EQUALITY(r, dividends[i] % f300, "div_mod reciprocal remainder    ");
+        ASSERT_EQUALITY(q * f300 + r, dividends[i], "div_mod reciprocal q * d + r    ");
+    }
+
+    // the newton division tier.
+    apa::integer square = max * max;
+    ASSERT_EQUALITY(square / max, max, "(B^70 - 1)^2 / (B^70 - 1)       ");
+    ASSERT_EQUALITY((square - apa::__INTEGER_ONE) % max, max - apa::__INTEGER_ONE, "((B^70 - 1)^2 - 1) % (B^70 - 1) ");
+    ASSERT_EQUALITY(f1500 / f900 * f900, f1500, "(1500! / 900!) * 900!           ");
+    ASSERT_EQUALITY((f1500 + f40) % f900, f40, "(1500! + 40!) % 900!            ");
+
+#if defined(_BASE2_16)
+    RESULT("INTEGER BASE 2^16 RECIPROCAL");
+#elif defined(_BASE2_32)
+    RESULT("INTEGER BASE 2^32 RECIPROCAL");
+#elif defined(_BASE2_64)
+    RESULT("INTEGER BASE 2^64 RECIPROCAL");
+#endif
+}